@@ -0,0 +1,101 @@
+#!/bin/sh
+# ----------------------------------------
+# Benchmark of the execution engines
+# ----------------------------------------
+#
+# [Usage] bench/bench.sh interpreter measure results.csv [baseline.csv]
+#
+# Runs every program of the suite BENCH_RUNS times (default 3) on each engine
+# of BENCH_ENGINES (default all of them) and writes to results.csv the best
+# wall time of the runs, with its operations per second, the peak resident
+# memory and the output checksum. The operations are counted once per program
+# by --profile. Runs whose output differs from the reference engine fail the
+# benchmark, and so do, when a baseline from a previous benchmark is given,
+# runs whose output changed or that became more than BENCH_TOLERANCE percent
+# (default 10) slower.
+
+INTERPRETER=$1
+MEASURE=$2
+RESULTS=$3
+BASELINE=$4
+ENGINES=${BENCH_ENGINES:-"reference switch threaded jit"}
+RUNS=${BENCH_RUNS:-3}
+TOLERANCE=${BENCH_TOLERANCE:-10}
+BENCHDIR=$(dirname "$0")
+
+if [ -z "$RESULTS" ]; then
+    echo "[Usage] $0 interpreter measure results.csv [baseline.csv]" >&2
+    exit 1
+fi
+
+WORKDIR=$(mktemp -d)
+trap 'rm -rf "$WORKDIR"' EXIT INT TERM
+
+# Inputs of the filters: repeated lines of text
+yes "The quick brown fox jumps over the lazy dog, 0123456789 times!" | head -c 524288 > "$WORKDIR/text.txt"
+yes "Pack my box with five dozen liquor jugs; sphinx of black quartz, judge my vow." | head -c 16777216 > "$WORKDIR/large.txt"
+
+# name, program, options and input (empty for none) of every benchmark
+WORKLOADS="
+mandelbrot|$BENCHDIR/mandelbrot.b|-b=16|
+primes|$BENCHDIR/primes.b|-b=16|
+hanoi|$BENCHDIR/hanoi.b||
+scans|$BENCHDIR/scans.b||
+rot13|$BENCHDIR/rot13.b||text.txt
+cat|BrainFuck/cat.b||large.txt
+"
+
+echo "program,engine,seconds,operations,operations_per_second,max_rss_kib,checksum,status" > "$RESULTS"
+printf "%-12s %-10s %10s %14s %12s %12s\n" "program" "engine" "seconds" "Mops/s" "RSS KiB" "checksum"
+
+echo "$WORKLOADS" | while IFS='|' read -r name program option input; do
+    [ -n "$name" ] || continue
+    if [ -n "$input" ]; then
+        stdin="$WORKDIR/$input"
+    else
+        stdin=/dev/null
+    fi
+    "$INTERPRETER" "$program" $option --profile < "$stdin" 2> "$WORKDIR/profile.txt" > /dev/null
+    operations=$(sed -n 's/^\[Profile\]: \([0-9]*\) operations.*/\1/p' "$WORKDIR/profile.txt")
+    expected=
+    for engine in $ENGINES; do
+        seconds=
+        rss=0
+        status=0
+        run=0
+        while [ "$run" -lt "$RUNS" ]; do
+            "$MEASURE" "$WORKDIR/measure.txt" "$INTERPRETER" "$program" $option --engine="$engine" < "$stdin" > "$WORKDIR/output.txt"
+            read -r runSeconds runRss runStatus < "$WORKDIR/measure.txt"
+            seconds=$(awk -v a="$seconds" -v b="$runSeconds" 'BEGIN { print (a == "" || b < a) ? b : a }')
+            [ "$runRss" -le "$rss" ] || rss=$runRss
+            [ "$runStatus" = 0 ] || status=$runStatus
+            run=$((run + 1))
+        done
+        checksum=$(cksum < "$WORKDIR/output.txt" | cut -d ' ' -f 1)
+        rate=$(awk -v ops="$operations" -v s="$seconds" 'BEGIN { printf "%.0f", (s > 0 ? ops / s : 0) }')
+        echo "$name,$engine,$seconds,$operations,$rate,$rss,$checksum,$status" >> "$RESULTS"
+        note=
+        [ -n "$expected" ] || expected=$checksum
+        if [ "$status" != 0 ]; then
+            note="failed with status $status"
+        elif [ "$checksum" != "$expected" ]; then
+            note="output differs from the $(echo $ENGINES | cut -d ' ' -f 1) engine"
+        fi
+        if [ -z "$note" ] && [ -n "$BASELINE" ]; then
+            note=$(awk -F , -v name="$name" -v engine="$engine" -v s="$seconds" -v sum="$checksum" -v tolerance="$TOLERANCE" '
+                $1 == name && $2 == engine {
+                    if ($7 != sum) print "output changed since the baseline"
+                    else if (s > $3 * (1 + tolerance / 100)) printf "%.1f%% slower than the baseline\n", 100 * (s / $3 - 1)
+                }' "$BASELINE")
+        fi
+        printf "%-12s %-10s %10.3f %14.1f %12s %12s %s\n" "$name" "$engine" "$seconds" "$(awk -v r="$rate" 'BEGIN { print r / 1e6 }')" "$rss" "$checksum" "${note:+<== $note}"
+        [ -z "$note" ] || echo "$name $engine" >> "$WORKDIR/failures.txt"
+    done
+done
+
+echo
+echo "Results written to $RESULTS"
+if [ -s "$WORKDIR/failures.txt" ]; then
+    echo "[Error]: $(wc -l < "$WORKDIR/failures.txt") benchmark runs failed" >&2
+    exit 1
+fi
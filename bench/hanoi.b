@@ -0,0 +1,349 @@
+Towers of Hanoi with 20 disks
+
+Prints the 1048575 moves that bring 20 disks from peg A to peg C
+The moves are found without recursion: a binary counter tells which
+disk moves at each step and every disk always turns in the same
+direction around the pegs
+
+Written for the benchmark suite of this interpreter
+
+[-]+[>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+[->+>+<<]>>[-<<+>>]<[<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>+
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>]<+<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]<[-]]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]>>>>>++++++++++[-<+++++++++
++>]<.+++++.++++++++++.--------.>++++++++[-<--------->]<---.+++++++++++++++++.+++
+++++++.>+++++[-<----->]<-.[-]++++++++[-<<<<<<<<<<<<<<<<<<<<<<<<++++++++>>>>>>>>>
+>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<+.>>>>>>>>>>>>>>>>>>>>>>>>++++++++[-<<<<
+<<<<<<<<<<<<<<<<<<<<-------->>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<-+[
+->>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>
+>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>]<---<[-]+>[->+>+<<]>>[
+-<<+>>]<[<<[-]>>[-]]<[-]<[->+>+<<]>>[-<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>
+>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>+>+<<
+<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<+
+>>>>>>>>>>>>>>>>>>>>>>>>>>]<----<[-]+>[->+>+<<]>>[-<<+>>]<[<<[-]>>[-]]<[-]<[->+>
++<<]>>[-<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<[-]>+
+++++[-<++++++>]<++.+++++++++++++.+++++++++++++++++.>+++++[-<------>]<.[-]+++++++
++[-<<<<<<<<<<<<<<<<<<<<<<<<++++++++>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<
+<<<<+.>>>>>>>>>>>>>>>>>>>>>>>>++++++++[-<<<<<<<<<<<<<<<<<<<<<<<<-------->>>>>>>>
+>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>>>>>>>++++++++++.[-]
+<[-]]<<[-]]<[->+>>+<<<]>>>[-<<<+>>>]<<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[
+->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<+>[<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]>[-
+]]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>[-]>>>>>++++++++++[-<++++++++++>]<.+++++.++++++++++.--------.>++++++++[-
+<--------->]<---.++++++++++++++++++.++++++++.>+++++[-<----->]<-.[-]++++++++[-<<<
+<<<<<<<<<<<<<<<<<<<<++++++++>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<+.>>>
+>>>>>>>>>>>>>>>>>>>>++++++++[-<<<<<<<<<<<<<<<<<<<<<<<-------->>>>>>>>>>>>>>>>>>>
+>>>>]<<<<<<<<<<<<<<<<<<<<<<<-++[->>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<
+<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>
+>>>>]<---<[-]+>[->+>+<<]>>[-<<+>>]<[<<[-]>>[-]]<[-]<[->+>+<<]>>[-<<+>>]<[<<<<<<<
+<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>
+>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<
+<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>]<----<[-]+>[->+>+<<]>>[-<<+>>]<[<<
+[-]>>[-]]<[-]<[->+>+<<]>>[-<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>
+>>>>>>>[-]]<[-]>+++++[-<++++++>]<++.+++++++++++++.+++++++++++++++++.>+++++[-<---
+--->]<.[-]++++++++[-<<<<<<<<<<<<<<<<<<<<<<<++++++++>>>>>>>>>>>>>>>>>>>>>>>]<<<<<
+<<<<<<<<<<<<<<<<<<+.>>>>>>>>>>>>>>>>>>>>>>>++++++++[-<<<<<<<<<<<<<<<<<<<<<<<----
+---->>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>>>>>>+++++
++++++.[-]<<[-]]<[-]]<[->+>+<<]>>[-<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<+<[<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]<[-]]>[<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>[-]>>>>>++++++++++[-<++++++++++>]<.+++++.++++++++++.--------.>++++++++[-<------
+--->]<---.+++++++++++++++++++.+++++++.>+++++[-<----->]<-.[-]++++++++[-<<<<<<<<<<
+<<<<<<<<<<<<++++++++>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<+.>>>>>>>>>>>>>
+>>>>>>>>>++++++++[-<<<<<<<<<<<<<<<<<<<<<<-------->>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<
+<<<<<<<<<<<<<<-+[->>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>
+>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>]<---<[-]+>[->+>
++<<]>>[-<<+>>]<[<<[-]>>[-]]<[-]<[->+>+<<]>>[-<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<[-]>
+>>>>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>+>+<<<
+<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>
+>>>>>>>>>>>>>>>>>]<----<[-]+>[->+>+<<]>>[-<<+>>]<[<<[-]>>[-]]<[-]<[->+>+<<]>>[-<
+<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>>>[-]]<[-]>+++++[-<++++++
+>]<++.+++++++++++++.+++++++++++++++++.>+++++[-<------>]<.[-]++++++++[-<<<<<<<<<<
+<<<<<<<<<<<<++++++++>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<+.>>>>>>>>>>>>>
+>>>>>>>>>++++++++[-<<<<<<<<<<<<<<<<<<<<<<-------->>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<
+<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>>>>>++++++++++.[-]<[-]]<<[-]]<[->+>>+<<<]>>>[-<
+<<+>>>]<<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>]<<+>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]>[-]]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]>>>>>++++++++++[-<++++++++++>]<.+++++.
+++++++++++.--------.>++++++++[-<--------->]<---.++++++++++++++++++++.++++++.>+++
+++[-<----->]<-.[-]++++++++[-<<<<<<<<<<<<<<<<<<<<<++++++++>>>>>>>>>>>>>>>>>>>>>]<
+<<<<<<<<<<<<<<<<<<<<+.>>>>>>>>>>>>>>>>>>>>>++++++++[-<<<<<<<<<<<<<<<<<<<<<------
+-->>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<-++[->>>>>>>>>>>>>>>>>>>>>>+>+<<<<<
+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>
+>>>>>>>>>>>]<---<[-]+>[->+>+<<]>>[-<<+>>]<[<<[-]>>[-]]<[-]<[->+>+<<]>>[-<<+>>]<[
+<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<<<<<<<<<[->>>>>
+>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<
+<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>]<----<[-]+>[->+>+<<]>>[-<<+>>]<[<<[-]>>[-]]
+<[-]<[->+>+<<]>>[-<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>>[-]]<[
+-]>+++++[-<++++++>]<++.+++++++++++++.+++++++++++++++++.>+++++[-<------>]<.[-]+++
++++++[-<<<<<<<<<<<<<<<<<<<<<++++++++>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<+
+.>>>>>>>>>>>>>>>>>>>>>++++++++[-<<<<<<<<<<<<<<<<<<<<<-------->>>>>>>>>>>>>>>>>>>
+>>]<<<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>>>>++++++++++.[-]<<[-]]<[-]]<[->+>+<<
+]>>[-<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>]<+<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>[-]<[-]]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]>>>>>++++++++++[-<++++++++++>]<.+++++.+++++++
++++.--------.>++++++++[-<--------->]<---.+++++++++++++++++++++.+++++.>+++++[-<--
+--->]<-.[-]++++++++[-<<<<<<<<<<<<<<<<<<<<++++++++>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<
+<<<<<<<<<<+.>>>>>>>>>>>>>>>>>>>>++++++++[-<<<<<<<<<<<<<<<<<<<<-------->>>>>>>>>>
+>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<-+[->>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<
+<]>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>]<---<[-]
++>[->+>+<<]>>[-<<+>>]<[<<[-]>>[-]]<[-]<[->+>+<<]>>[-<<+>>]<[<<<<<<<<<<<<<<<<<<<<
+<[-]>>>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>+>+<<<<
+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>
+>>>>>>>>]<----<[-]+>[->+>+<<]>>[-<<+>>]<[<<[-]>>[-]]<[-]<[->+>+<<]>>[-<<+>>]<[<<
+<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>[-]]<[-]>+++++[-<++++++>]<++.+++++++
+++++++.+++++++++++++++++.>+++++[-<------>]<.[-]++++++++[-<<<<<<<<<<<<<<<<<<<<+++
++++++>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<+.>>>>>>>>>>>>>>>>>>>>++++++++[-<<
+<<<<<<<<<<<<<<<<<<-------->>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>
+>>>>>>>>++++++++++.[-]<[-]]<<[-]]<[->+>>+<<<]>>>[-<<<+>>>]<<[<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<+>[<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]>[-]]<[<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]>>>>>++
+++++++++[-<++++++++++>]<.+++++.++++++++++.--------.>++++++++[-<--------->]<---.+
++++++++++++++++++++++.++++.>+++++[-<----->]<-.[-]++++++++[-<<<<<<<<<<<<<<<<<<<++
+++++++>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<+.>>>>>>>>>>>>>>>>>>>++++++++[-<<<<
+<<<<<<<<<<<<<<<-------->>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<-++[->>>>>>>>>>>>>
+>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<+>>>
+>>>>>>>>>>>>>>>>>>]<---<[-]+>[->+>+<<]>>[-<<+>>]<[<<[-]>>[-]]<[-]<[->+>+<<]>>[-<
+<+>>]<[<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<<<<<<<[->>>>
+>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<
+<<<<<+>>>>>>>>>>>>>>>>>>>>>]<----<[-]+>[->+>+<<]>>[-<<+>>]<[<<[-]>>[-]]<[-]<[->+
+>+<<]>>[-<<+>>]<[<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>[-]]<[-]>+++++[-<++
+++++>]<++.+++++++++++++.+++++++++++++++++.>+++++[-<------>]<.[-]++++++++[-<<<<<<
+<<<<<<<<<<<<<++++++++>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<+.>>>>>>>>>>>>>>>>>>
+>++++++++[-<<<<<<<<<<<<<<<<<<<-------->>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<->>
+>>>>>>>>>>>>>>>>>++++++++++.[-]<<[-]]<[-]]<[->+>+<<]>>[-<<+>>]<[<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<+<[<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]<[-]]>[<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]>>>>>+++++++++
++[-<++++++++++>]<.+++++.++++++++++.--------.>++++++++[-<--------->]<---.++++++++
++++++++++++++++.+++.>+++++[-<----->]<-.[-]++++++++[-<<<<<<<<<<<<<<<<<<++++++++>>
+>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<+.>>>>>>>>>>>>>>>>>>++++++++[-<<<<<<<<<<<<<<<
+<<<-------->>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<-+[->>>>>>>>>>>>>>>>>>>+>+<<<<<<
+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>]<
+---<[-]+>[->+>+<<]>>[-<<+>>]<[<<[-]>>[-]]<[-]<[->+>+<<]>>[-<<+>>]<[<<<<<<<<<<<<<
+<<<<<<[-]>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>+>+<<<<<
+<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>]
+<----<[-]+>[->+>+<<]>>[-<<+>>]<[<<[-]>>[-]]<[-]<[->+>+<<]>>[-<<+>>]<[<<<<<<<<<<<
+<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>[-]]<[-]>+++++[-<++++++>]<++.+++++++++++++.++++++
++++++++++++.>+++++[-<------>]<.[-]++++++++[-<<<<<<<<<<<<<<<<<<++++++++>>>>>>>>>>
+>>>>>>>>]<<<<<<<<<<<<<<<<<<+.>>>>>>>>>>>>>>>>>>++++++++[-<<<<<<<<<<<<<<<<<<-----
+--->>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>++++++++++.[-]<[-]]<<
+[-]]<[->+>>+<<<]>>>[-<<<+>>>]<<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>]<<+>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>[-]>[-]]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>[-]>>>>>++++++++++[-<++++++++++>]<.+++++.++++++++++.-------
+-.>++++++++[-<--------->]<---.++++++++++++++++++++++++.++.>+++++[-<----->]<-.[-]
+++++++++[-<<<<<<<<<<<<<<<<<++++++++>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<+.>>>>>>>>
+>>>>>>>>>++++++++[-<<<<<<<<<<<<<<<<<-------->>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<-
+++[->>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<
+<<<<<+>>>>>>>>>>>>>>>>>>>]<---<[-]+>[->+>+<<]>>[-<<+>>]<[<<[-]>>[-]]<[-]<[->+>+<
+<]>>[-<<+>>]<[<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<<<<<[->>>
+>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<+>
+>>>>>>>>>>>>>>>>>>]<----<[-]+>[->+>+<<]>>[-<<+>>]<[<<[-]>>[-]]<[-]<[->+>+<<]>>[-
+<<+>>]<[<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>[-]]<[-]>+++++[-<++++++>]<++.+++
+++++++++++.+++++++++++++++++.>+++++[-<------>]<.[-]++++++++[-<<<<<<<<<<<<<<<<<++
+++++++>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<+.>>>>>>>>>>>>>>>>>++++++++[-<<<<<<<<<<
+<<<<<<<-------->>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>++++++++++.[
+-]<<[-]]<[-]]<[->+>+<<]>>[-<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>]<+<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>[-]<[-]]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>[-]>>>>>++++++++++[-<++++++++++>]<.+++++.++++++++++.--------.>++++
+++++[-<--------->]<---.>+++++[-<+++++>]<.+.>+++++[-<----->]<-.[-]++++++++[-<<<<<
+<<<<<<<<<<<++++++++>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<+.>>>>>>>>>>>>>>>>++++++++[-
+<<<<<<<<<<<<<<<<-------->>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<-+[->>>>>>>>>>>>>>>>>+>
++<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>]<-
+--<[-]+>[->+>+<<]>>[-<<+>>]<[<<[-]>>[-]]<[-]<[->+>+<<]>>[-<<+>>]<[<<<<<<<<<<<<<<
+<<<[-]>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<
+<<<<]>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>]<----<[-]+>[->+>+
+<<]>>[-<<+>>]<[<<[-]>>[-]]<[-]<[->+>+<<]>>[-<<+>>]<[<<<<<<<<<<<<<<<<<[-]+>>>>>>>
+>>>>>>>>>>[-]]<[-]>+++++[-<++++++>]<++.+++++++++++++.+++++++++++++++++.>+++++[-<
+------>]<.[-]++++++++[-<<<<<<<<<<<<<<<<++++++++>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<
++.>>>>>>>>>>>>>>>>++++++++[-<<<<<<<<<<<<<<<<-------->>>>>>>>>>>>>>>>]<<<<<<<<<<<
+<<<<<->>>>>>>>>>>>>>>>++++++++++.[-]<[-]]<<[-]]<[->+>>+<<<]>>>[-<<<+>>>]<<[<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<+>[<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]>[-]]<[<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]>>>>>++++++++++[-<++++++++++>]<.+
+++++.++++++++++.--------.>++++++++[-<--------->]<---.+++++++++++++++++.-.+++++++
++++.>+++++[-<----->]<-.[-]++++++++[-<<<<<<<<<<<<<<<++++++++>>>>>>>>>>>>>>>]<<<<<
+<<<<<<<<<<+.>>>>>>>>>>>>>>>++++++++[-<<<<<<<<<<<<<<<-------->>>>>>>>>>>>>>>]<<<<
+<<<<<<<<<<<-++[->>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>[-<<<<<<<<
+<<<<<<<<<+>>>>>>>>>>>>>>>>>]<---<[-]+>[->+>+<<]>>[-<<+>>]<[<<[-]>>[-]]<[-]<[->+>
++<<]>>[-<<+>>]<[<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<<<[->>>>>>>
+>>>>>>>>>+>+<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>
+>>>>]<----<[-]+>[->+>+<<]>>[-<<+>>]<[<<[-]>>[-]]<[-]<[->+>+<<]>>[-<<+>>]<[<<<<<<
+<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>[-]]<[-]>+++++[-<++++++>]<++.+++++++++++++.+++++++
+++++++++++.>+++++[-<------>]<.[-]++++++++[-<<<<<<<<<<<<<<<++++++++>>>>>>>>>>>>>>
+>]<<<<<<<<<<<<<<<+.>>>>>>>>>>>>>>>++++++++[-<<<<<<<<<<<<<<<-------->>>>>>>>>>>>>
+>>]<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>++++++++++.[-]<<[-]]<[-]]<[->+>+<<]>>[-<<+>>]<
+[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<+<[<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]<[-]]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]>>>>>++++++++++[-<++++++++++>]<.+++++
+.++++++++++.--------.>++++++++[-<--------->]<---.+++++++++++++++++..+++++++++.>+
+++++[-<----->]<-.[-]++++++++[-<<<<<<<<<<<<<<++++++++>>>>>>>>>>>>>>]<<<<<<<<<<<<<
+<+.>>>>>>>>>>>>>>++++++++[-<<<<<<<<<<<<<<-------->>>>>>>>>>>>>>]<<<<<<<<<<<<<<-+
+[->>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>
+>>>>>>>>]<---<[-]+>[->+>+<<]>>[-<<+>>]<[<<[-]>>[-]]<[-]<[->+>+<<]>>[-<<+>>]<[<<<
+<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>+>+<<<<<<<<<<<
+<<<<<]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]<----<[-]+>[->+>+<<]>>
+[-<<+>>]<[<<[-]>>[-]]<[-]<[->+>+<<]>>[-<<+>>]<[<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>
+>[-]]<[-]>+++++[-<++++++>]<++.+++++++++++++.+++++++++++++++++.>+++++[-<------>]<
+.[-]++++++++[-<<<<<<<<<<<<<<++++++++>>>>>>>>>>>>>>]<<<<<<<<<<<<<<+.>>>>>>>>>>>>>
+>++++++++[-<<<<<<<<<<<<<<-------->>>>>>>>>>>>>>]<<<<<<<<<<<<<<->>>>>>>>>>>>>>+++
++++++++.[-]<[-]]<<[-]]<[->+>>+<<<]>>>[-<<<+>>>]<<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>]<<+>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>[-]>[-]]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[
+-]>>>>>++++++++++[-<++++++++++>]<.+++++.++++++++++.--------.>++++++++[-<--------
+->]<---.+++++++++++++++++.+.++++++++.>+++++[-<----->]<-.[-]++++++++[-<<<<<<<<<<<
+<<++++++++>>>>>>>>>>>>>]<<<<<<<<<<<<<+.>>>>>>>>>>>>>++++++++[-<<<<<<<<<<<<<-----
+--->>>>>>>>>>>>>]<<<<<<<<<<<<<-++[->>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<]>>>>>>>>>>>>
+>>>[-<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>]<---<[-]+>[->+>+<<]>>[-<<+>>]<[<<[-]>>[-]]<
+[-]<[->+>+<<]>>[-<<+>>]<[<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<[->>>>
+>>>>>>>>>>+>+<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>]<-
+---<[-]+>[->+>+<<]>>[-<<+>>]<[<<[-]>>[-]]<[-]<[->+>+<<]>>[-<<+>>]<[<<<<<<<<<<<<<
+<[-]+>>>>>>>>>>>>>>[-]]<[-]>+++++[-<++++++>]<++.+++++++++++++.+++++++++++++++++.
+>+++++[-<------>]<.[-]++++++++[-<<<<<<<<<<<<<++++++++>>>>>>>>>>>>>]<<<<<<<<<<<<<
++.>>>>>>>>>>>>>++++++++[-<<<<<<<<<<<<<-------->>>>>>>>>>>>>]<<<<<<<<<<<<<->>>>>>
+>>>>>>>++++++++++.[-]<<[-]]<[-]]<[->+>+<<]>>[-<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>]<+<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+[-]<[-]]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]>>>>
+>++++++++++[-<++++++++++>]<.+++++.++++++++++.--------.>++++++++[-<--------->]<--
+-.+++++++++++++++++.++.+++++++.>+++++[-<----->]<-.[-]++++++++[-<<<<<<<<<<<<+++++
++++>>>>>>>>>>>>]<<<<<<<<<<<<+.>>>>>>>>>>>>++++++++[-<<<<<<<<<<<<-------->>>>>>>>
+>>>>]<<<<<<<<<<<<-+[->>>>>>>>>>>>>+>+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<
+<<+>>>>>>>>>>>>>>]<---<[-]+>[->+>+<<]>>[-<<+>>]<[<<[-]>>[-]]<[-]<[->+>+<<]>>[-<<
++>>]<[<<<<<<<<<<<<<[-]>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<[->>>>>>>>>>>>>+>+<<<<<<<<<<
+<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<----<[-]+>[->+>+<<]>>[-<<+>>
+]<[<<[-]>>[-]]<[-]<[->+>+<<]>>[-<<+>>]<[<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>[-]]<[-]>+
+++++[-<++++++>]<++.+++++++++++++.+++++++++++++++++.>+++++[-<------>]<.[-]+++++++
++[-<<<<<<<<<<<<++++++++>>>>>>>>>>>>]<<<<<<<<<<<<+.>>>>>>>>>>>>++++++++[-<<<<<<<<
+<<<<-------->>>>>>>>>>>>]<<<<<<<<<<<<->>>>>>>>>>>>++++++++++.[-]<[-]]<<[-]]<[->+
+>>+<<<]>>>[-<<<+>>>]<<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<+>[<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]>[-]]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<[-]+>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]>>>>>++++++++++[-<++++++++++>]<.+++++.+++++++
++++.--------.>++++++++[-<--------->]<---.+++++++++++++++++.+++.++++++.>+++++[-<-
+---->]<-.[-]++++++++[-<<<<<<<<<<<++++++++>>>>>>>>>>>]<<<<<<<<<<<+.>>>>>>>>>>>+++
++++++[-<<<<<<<<<<<-------->>>>>>>>>>>]<<<<<<<<<<<-++[->>>>>>>>>>>>+>+<<<<<<<<<<<
+<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]<---<[-]+>[->+>+<<]>>[-<<+>>]<[<<[
+-]>>[-]]<[-]<[->+>+<<]>>[-<<+>>]<[<<<<<<<<<<<<[-]>>>>>>>>>>>>[-]]<<<<<<<<<<<<[->
+>>>>>>>>>>>+>+<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]<----<[-]
++>[->+>+<<]>>[-<<+>>]<[<<[-]>>[-]]<[-]<[->+>+<<]>>[-<<+>>]<[<<<<<<<<<<<<[-]+>>>>
+>>>>>>>>[-]]<[-]>+++++[-<++++++>]<++.+++++++++++++.+++++++++++++++++.>+++++[-<--
+---->]<.[-]++++++++[-<<<<<<<<<<<++++++++>>>>>>>>>>>]<<<<<<<<<<<+.>>>>>>>>>>>++++
+++++[-<<<<<<<<<<<-------->>>>>>>>>>>]<<<<<<<<<<<->>>>>>>>>>>++++++++++.[-]<<[-]]
+<[-]]<[->+>+<<]>>[-<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>
+>>>>+>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<+<[<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]<[-]]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+
+>>>>>>>>>>>>>>>>>>>>>>>>>>[-]>>>>>++++++++++[-<++++++++++>]<.+++++.++++++++++.--
+------.>++++++++[-<--------->]<---.+++++++++++++++++.++++.+++++.>+++++[-<----->]
+<-.[-]++++++++[-<<<<<<<<<<++++++++>>>>>>>>>>]<<<<<<<<<<+.>>>>>>>>>>++++++++[-<<<
+<<<<<<<-------->>>>>>>>>>]<<<<<<<<<<-+[->>>>>>>>>>>+>+<<<<<<<<<<<<]>>>>>>>>>>>>[
+-<<<<<<<<<<<<+>>>>>>>>>>>>]<---<[-]+>[->+>+<<]>>[-<<+>>]<[<<[-]>>[-]]<[-]<[->+>+
+<<]>>[-<<+>>]<[<<<<<<<<<<<[-]>>>>>>>>>>>[-]]<<<<<<<<<<<[->>>>>>>>>>>+>+<<<<<<<<<
+<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]<----<[-]+>[->+>+<<]>>[-<<+>>]<[<<[-
+]>>[-]]<[-]<[->+>+<<]>>[-<<+>>]<[<<<<<<<<<<<[-]+>>>>>>>>>>>[-]]<[-]>+++++[-<++++
+++>]<++.+++++++++++++.+++++++++++++++++.>+++++[-<------>]<.[-]++++++++[-<<<<<<<<
+<<++++++++>>>>>>>>>>]<<<<<<<<<<+.>>>>>>>>>>++++++++[-<<<<<<<<<<-------->>>>>>>>>
+>]<<<<<<<<<<->>>>>>>>>>++++++++++.[-]<[-]]<<[-]]<[->+>>+<<<]>>>[-<<<+>>>]<<[<<<<
+<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>]<<+>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>[
+-]>[-]]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>>>>>[-]>>>>>+++++++
++++[-<++++++++++>]<.+++++.++++++++++.--------.>++++++++[-<--------->]<---.++++++
++++++++++++.+++++.++++.>+++++[-<----->]<-.[-]++++++++[-<<<<<<<<<++++++++>>>>>>>>
+>]<<<<<<<<<+.>>>>>>>>>++++++++[-<<<<<<<<<-------->>>>>>>>>]<<<<<<<<<-++[->>>>>>>
+>>>+>+<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<---<[-]+>[->+>+<<]>>[-<<
++>>]<[<<[-]>>[-]]<[-]<[->+>+<<]>>[-<<+>>]<[<<<<<<<<<<[-]>>>>>>>>>>[-]]<<<<<<<<<<
+[->>>>>>>>>>+>+<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<----<[-]+>[->+>
++<<]>>[-<<+>>]<[<<[-]>>[-]]<[-]<[->+>+<<]>>[-<<+>>]<[<<<<<<<<<<[-]+>>>>>>>>>>[-]
+]<[-]>+++++[-<++++++>]<++.+++++++++++++.+++++++++++++++++.>+++++[-<------>]<.[-]
+++++++++[-<<<<<<<<<++++++++>>>>>>>>>]<<<<<<<<<+.>>>>>>>>>++++++++[-<<<<<<<<<----
+---->>>>>>>>>]<<<<<<<<<->>>>>>>>>++++++++++.[-]<<[-]]<[-]]<[->+>+<<]>>[-<<+>>]<[
+<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>]<+<[<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]<[-
+]]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>>>>[-]>>>>>++++++++++[-<
+++++++++++>]<.+++++.++++++++++.--------.>++++++++[-<--------->]<---.++++++++++++
++++++.++++++.+++.>+++++[-<----->]<-.[-]++++++++[-<<<<<<<<++++++++>>>>>>>>]<<<<<<
+<<+.>>>>>>>>++++++++[-<<<<<<<<-------->>>>>>>>]<<<<<<<<-+[->>>>>>>>>+>+<<<<<<<<<
+<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<---<[-]+>[->+>+<<]>>[-<<+>>]<[<<[-]>>[-]]<[
+-]<[->+>+<<]>>[-<<+>>]<[<<<<<<<<<[-]>>>>>>>>>[-]]<<<<<<<<<[->>>>>>>>>+>+<<<<<<<<
+<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<----<[-]+>[->+>+<<]>>[-<<+>>]<[<<[-]>>[-]]
+<[-]<[->+>+<<]>>[-<<+>>]<[<<<<<<<<<[-]+>>>>>>>>>[-]]<[-]>+++++[-<++++++>]<++.+++
+++++++++++.+++++++++++++++++.>+++++[-<------>]<.[-]++++++++[-<<<<<<<<++++++++>>>
+>>>>>]<<<<<<<<+.>>>>>>>>++++++++[-<<<<<<<<-------->>>>>>>>]<<<<<<<<->>>>>>>>++++
+++++++.[-]<[-]]<<[-]]<[->+>>+<<<]>>>[-<<<+>>>]<<[<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>
+>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>[
+-<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<+>[<<<<<<<<<<<<<<<<<<
+<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>[-]>[-]]<[<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>
+>>>>>>>>>>>>>>>>>>[-]>>>>>++++++++++[-<++++++++++>]<.+++++.++++++++++.--------.>
+++++++++[-<--------->]<---.+++++++++++++++++.+++++++.++.>+++++[-<----->]<-.[-]++
+++++++[-<<<<<<<++++++++>>>>>>>]<<<<<<<+.>>>>>>>++++++++[-<<<<<<<-------->>>>>>>]
+<<<<<<<-++[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<---<[-]+>[->+>+
+<<]>>[-<<+>>]<[<<[-]>>[-]]<[-]<[->+>+<<]>>[-<<+>>]<[<<<<<<<<[-]>>>>>>>>[-]]<<<<<
+<<<[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<----<[-]+>[->+>+<<]>>[
+-<<+>>]<[<<[-]>>[-]]<[-]<[->+>+<<]>>[-<<+>>]<[<<<<<<<<[-]+>>>>>>>>[-]]<[-]>+++++
+[-<++++++>]<++.+++++++++++++.+++++++++++++++++.>+++++[-<------>]<.[-]++++++++[-<
+<<<<<<++++++++>>>>>>>]<<<<<<<+.>>>>>>>++++++++[-<<<<<<<-------->>>>>>>]<<<<<<<->
+>>>>>>++++++++++.[-]<<[-]]<[-]]<[->+>+<<]>>[-<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<[->>
+>>>>>>>>>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>[
+-<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>]<+<[<<<<<<<<<<<<<<<<<<<<<
+<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>[-]<[-]]>[<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>
+>>>>>>>>>>>>[-]>>>>>++++++++++[-<++++++++++>]<.+++++.++++++++++.--------.>++++++
+++[-<--------->]<---.+++++++++++++++++.++++++++.+.>+++++[-<----->]<-.[-]++++++++
+[-<<<<<<++++++++>>>>>>]<<<<<<+.>>>>>>++++++++[-<<<<<<-------->>>>>>]<<<<<<-+[->>
+>>>>>+>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<---<[-]+>[->+>+<<]>>[-<<+>>]<[<<[-
+]>>[-]]<[-]<[->+>+<<]>>[-<<+>>]<[<<<<<<<[-]>>>>>>>[-]]<<<<<<<[->>>>>>>+>+<<<<<<<
+<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<----<[-]+>[->+>+<<]>>[-<<+>>]<[<<[-]>>[-]]<[-]<[-
+>+>+<<]>>[-<<+>>]<[<<<<<<<[-]+>>>>>>>[-]]<[-]>+++++[-<++++++>]<++.+++++++++++++.
++++++++++++++++++.>+++++[-<------>]<.[-]++++++++[-<<<<<<++++++++>>>>>>]<<<<<<+.>
+>>>>>++++++++[-<<<<<<-------->>>>>>]<<<<<<->>>>>>++++++++++.[-]<[-]]<<[-]]<[->+>
+>+<<<]>>>[-<<<+>>>]<<[<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<
+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>
+>>>>>>>>>>>>>>>>>]<<+>[<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>[-]>[-]
+]<[<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>[-]>>>>>++++++++++[-<++++++++
+++>]<.+++++.++++++++++.--------.>++++++++[-<--------->]<---.++++++++++++++++++.-
+-.++++++++++.>+++++[-<----->]<-.[-]++++++++[-<<<<<++++++++>>>>>]<<<<<+.>>>>>++++
+++++[-<<<<<-------->>>>>]<<<<<-++[->>>>>>+>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<--
+-<[-]+>[->+>+<<]>>[-<<+>>]<[<<[-]>>[-]]<[-]<[->+>+<<]>>[-<<+>>]<[<<<<<<[-]>>>>>>
+[-]]<<<<<<[->>>>>>+>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<----<[-]+>[->+>+<<]>>[-<<
++>>]<[<<[-]>>[-]]<[-]<[->+>+<<]>>[-<<+>>]<[<<<<<<[-]+>>>>>>[-]]<[-]>+++++[-<++++
+++>]<++.+++++++++++++.+++++++++++++++++.>+++++[-<------>]<.[-]++++++++[-<<<<<+++
++++++>>>>>]<<<<<+.>>>>>++++++++[-<<<<<-------->>>>>]<<<<<->>>>>++++++++++.[-]<<[
+-]]<[-]]<[->+>+<<]>>[-<<+>>]<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<]
@@ -0,0 +1,177 @@
+Mandelbrot set renderer
+
+Draws 48 columns by 24 rows of the set between (minus 2; minus 1/5) and
+(1; 1/5) with at most 26 iterations per point: letters tell after how
+many iterations a point escaped and hashes mark the points of the set
+Arithmetic is done in fixed point with a scale of 32 on sign and
+magnitude pairs of cells: run it with 16 bits cells (cell bits=16)
+
+Written for the benchmark suite of this interpreter
+
+[-]++++++++++++++++++++++++>[-]>>++++++[-<<++++++++>>]<<>[-]+>[-]++++>>[-]++>>[-
+]>>>++++++++[-<<<++++++++>>>]<<<+>[-]>>+++++++++++[-<<+++++++++++>>]<<++++++++>[
+-]>+++++[-<+++++>]<+<<<<<<<<<[>>>>>>>>>>[-]>>>++++++[-<<<++++++++>>>]<<<>[-]>>++
+++++++[-<<++++++++>>]<<>[-]+<<[>>>>>>>>[-]+[>[-]+<<<<<<[->>>>>>>>+>>+<<<<<<<<<<]
+>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>+>+<<<<<<<<<<
+<<<<<<]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]<[<[->>+>>+<<<<]>>>>[
+-<<<<+>>>>]<+<[<<->>>[-]<[-]]>[<<<<<[-]>>>[-]+>>[-]]<<-]<[-]>[-]<<[-]+<<<<<[->>>
+>>>>+>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>
+>>+>>>+<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>]
+<<<[>[->>+>+<<<]>>>[-<<<+>>>]<<+>[<<->[-]>[-]]<[<<<[-]>[-]+>>[-]]<<-]>[-]<[-]<[-
+<+>>+<]>[-<+>]>>[-]+<<<<[->>>>>+>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<[<[-]>[-]]<[->+>
++<<]>>[-<<+>>]<[>[-]<<<<<<<<<<<<[->>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<]>>>>>>>>>>>
+>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]<[-<<<<<<<<<<<<<<<[->>>>>>>>>>>>+>>>>+<
+<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]<]<[-]>+++++
+[-<++++++>]<++<<<<<<[-]>>>>>[-]<[->>>+>>>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<<<<[->>+
+>>+<<<<]>>>>[-<<<<+>>>>]<<<[-<<+>>>->[-]+<[->>+>+<<<]>>>[-<<<+>>>]<[<[-]>[-]]<[<
+<<<<<<<<+>>>>>[-]>[->>+>>+<<<<]>>>>[-<<<<+>>>>]<[-]]<<][-]>[-]>[-]<<<<<[-]>[-]>[
+-][-]<<<<<<<<<<<<[->>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<
+<<+>>>>>>>>>>>>>>]>[-<<<<<<<<<<<<<<<[->>>>>>>>>>>>+>>+<<<<<<<<<<<<<<]>>>>>>>>>>>
+>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]>]<<<<<[-]>>>>>+++++[-<<<<<++++++>>>>>]<<<<<+
++<<<[-]>>>>[-]>[->>>+>+<<<<]>>>>[-<<<<+>>>>]<<<<<<[->>>>+>>+<<<<<<]>>>>>>[-<<<<<
+<+>>>>>>]<[-<<<<+>>>-<[-]+>[->>+>+<<<]>>>[-<<<+>>>]<[<<<[-]>>>[-]]<<<[<<<<<<+>>>
+>[-]<[->>>>+>>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<<<[-]]>>][-]<[-]<[-]<[-]<[-]<[-][-]
+<<<<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]<<<<[->>>+>+<<<<]>>>>[-<<<<+>>>>]<<<<<<<[-
+]+>>>>>>[->+>>+<<<]>>>[-<<<+>>>]<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>+>+<<<<
+<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>
+]<[<[->>+>>+<<<<]>>>>[-<<<<+>>>>]<+<[<<->>>[-]<[-]]>[<<<<<<<<<<[-]>>>>>>>>[-]+>>
+[-]]<<-]<[-]>[-]<<[-]<[-]]<[-]+<<<<[->>>>>+>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<[<[-]
+>[-]]<[->+>>>+<<<<]>>>>[-<<<<+>>>>]<<+<[>>>>>>>[-]<<<<<<<<<<<<<<<<<<[->>>>>>>>>>
+>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<
+<<<+>>>>>>>>>>>>>>>>>>>>>>]<[-<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>+>>>>+<<<<<<<
+<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>]<]
+[-]<<<[->>>+>+<<<<]>>>>[-<<<<+>>>>]<<<<[-]>>>[-<<<++>>>>+<]>[-<+>]<[-]<[-]>+++++
+[-<++++++>]<++<<<<<<[-]>>>>>[-]<[->>>+>>>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<<<<[->>+
+>>+<<<<]>>>>[-<<<<+>>>>]<<<[-<<+>>>->[-]+<[->>+>+<<<]>>>[-<<<+>>>]<[<[-]>[-]]<[<
+<<<<<<<<+>>>>>[-]>[->>+>>+<<<<]>>>>[-<<<<+>>>>]<[-]]<<][-]>[-]>[-]<<<<<[-]>[-]>[
+-][-]<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>
+>>>>>[-<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>
++<+<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]>[-<+<+>
+>]<<[->>+<<]>-<<<<<<[-]+>>>>>>[-<+>>>>>+<<<<]>>>>[-<<<<+>>>>]<<<<<[<<<<<[-]>>>>>
+[-]]>[-]>[-]<[-]<<<<<<[->>>>>>+<+<<<<<]>>>>>[-<<<<<+>>>>>]<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>]>[-<+>>>>>+<<<<]>>>>[-<<<<+>>>>]<<<<<->>[-]+<<[->>>>>+<+<<<<]>>>>[-<<<<+>>>>]
+>[<<<[-]>>>[-]]<<<<<[-]>[-]>[-<+>>>>+<<<]>>>[-<<<+>>>]<<<<<+>[>>>>[-]+<<<<<<<<<[
+->>>>>>>>+>>+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<[>[->>+>>+<<<<]>>>>[-<<<<+>>>>]<+<
+[<<->>>[-]<[-]]>[<<[-]<<[-]+>>>>[-]]<<<<-]>[-]<[-]>>[-<<+>>>>+<<]>>[-<<+>>]<<<+<
+[<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<
+<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+[->>>>>>>>>>>>>>->>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>[-<<<<<<<<<
+<+>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]<<
+<[-]<[-]]>[<<<<<<<<<<<<<<<<<<<<[-]<<<<<<<<<<<<<<[->>>>>>>>>>>>>>+>>>>>>>>>>>>>>>
+>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>]<<<<<<<<<<<[-<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<]>>>>>>>>>>>[-<<<
+<<<<<<<<+>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<[-]<<<<<<<<<<<<<<[->>>>>>>>>>>>>>+>>>
+>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>]<<<[-]]>[-]<<<<<[-]>[-]]<[<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>[-<<<<<<<<<<<<
++>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>+>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>[-<<
+<<<<<<<<+>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<<<<<
+[-]]>>[-]<<<<[-]+>>[-]<<<<<<<<<<<[->>>>>>>>>>>+>+<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<
+<<<<<<<<+>>>>>>>>>>>>]<<<[->>+>+<<<]>>>[-<<<+>>>]<[->+>>>>+<<<<<]>>>>>[-<<<<<+>>
+>>>]<<<<->[-]+<[->>>>+<+<<<]>>>[-<<<+>>>]>[<<<[-]>>>[-]]<<<<[-]<[-]>>[-<<+>>>>>+
+<<<]>>>[-<<<+>>>]<<<<+<[>>>>>[-]+<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>+>>>+<<<<<<<<<<<
+<<<<<<]>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>+>>>>+<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>
+>>>>>>]<<<<[>[->>>+>+<<<<]>>>>[-<<<<+>>>>]<<+>[<<<->>[-]>[-]]<[<[-]<<[-]+>>>[-]]
+<<<-]>[-]<[-]>>[-<<+>>>+<]>[-<+>]<<+<[<<<<<<[-]<<<<<<<[->>>>>>>+>>>>>>>>>+<<<<<<
+<<<<<<<<<<]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<[-
+>>>>>>->>>>>>>>>+<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>
+>]<<<<<<<[-]<<<<<<<<<<[->>>>>>>>>>+>>>>>>>+<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>]<<[-]<[-]]>[<<<<<<<[-]<<<<<<[->>>>>>+>>>>>>>
+>>+<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>]<<<<<<<<<<<<
+<<<<[->>>>>>>->>>>>>>>>+<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>
+>>>>>>>>>>>>]<<<<<<<[-]<[->+>>>>>>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<[-]]>
+[-]<<<<[-]<[-]]>[<<<<[-]<<<<<<<[->>>>>>>+>>>>>>>>+<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>
+>[-<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<[->>>>>>+>>>>>>>>+<<<<<<<<<<<<<
+<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<<<<<<[-]<<<<<<<<<<[->>>>>>>>>>+
+>>>>>>+<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]<<<<
+[-]]>[-]<[-]<<[->>+<+<]>[-<+>]<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>+<+<<<<<<
+<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>]>[-<+
+>>>>>+<<<<]>>>>[-<<<<+>>>>]<<<<<->>[-]+<<[->>>>>+<+<<<<]>>>>[-<<<<+>>>>]>[<<<[-]
+>>>[-]]<<<<<[-]>[-]>[-<+>>>>+<<<]>>>[-<<<+>>>]<<<<<+>[>>>>[-]+<<<<<<<<[->>>>>>>+
+>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>
+>>>>>>>>>>>>>>>+>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<
+<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<[>[->>+>>+<<<<]>>>>[-<<<<+>>
+>>]<+<[<<->>>[-]<[-]]>[<<[-]<<[-]+>>>>[-]]<<<<-]>[-]<[-]>>[-<<+>>>>+<<]>>[-<<+>>
+]<<<+<[<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>
+>>>>>>>>>+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<
+<<[->>->>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>
+>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<
+<<<<<<<<<<[-]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<
+<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<<[-]<[-]]>[<<<<<<<<<<<<<<<<<<<<<<[-]<<[->>+>>>>>
+>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<
+<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<[-<<<<<<<<<<<<<<
+<->>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<<<<<<<
+<<<<<<<<<<<<<<<<<[-]<<[->>+>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<]>
+>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>
+]<<<[-]]>[-]<<<<<[-]>[-]]<[<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<
++>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<<<<<<<<<<<<<<<<<
+<<<<<<<[->>+>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>
+>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<
+<<<[-]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>+<<<<<<]>>>>>>[-<
+<<<<<+>>>>>>]<<<<<[-]]>>[-]<<<<<<[-]<[-]>>>[-]<[-]>>[-]<<<<<<<<<<<<<+[->>>>>>>>>
+>>>>+<<+<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]+++++[->>-----<<]>>-<<<
+<<<<<<<[-]+>>>>>>>>>>[-<<+>+>]<[->+<]<[<<<<<<<<[-]>>>>>>>>[-]]>>[-]<<<<<<<<<<[->
+>>>>>>>>>+<<+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]>>[<<<<<<<<<<<<[-]>>>>>>>>>>>>
+[-]]<<<<<[-]<[-]]>[<<<<<<<[-]>>>>>>>[-]]<<<<<<[-]>[-]>[-]>[-]>[-]<<<<<]<[->>>>>+
+<+<<<<]>>>>[-<<<<+>>>>]+++++[->-----<]>->[-]+<[-<+<+>>]<<[->>+<<]>[>>[-]<<[-]]>[
+-]>[-<+<<+>>>]<<<[->>>+<<<]>+>[<<<+++++[->+++++++<]>.[-]>[-]>[-]]<[<+++++++++[-<
+<<++++++++++>>>]<<<+++++++.>>>+++++++++[-<<<---------->>>]<<<------->>>>[-]]<<<<
+<<<<[-]>[-]>[-]>[-]>[-]>[-]>>>>>[-]<<<<<<<[-]<<<<[->>>>+<+<<<]>>>[-<<<+>>>]<<<<<
+<<<<[->>>>>>>>>>+<+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]>[-<+<+>>]<<[->>+<<]
+>->>[-]+<<[-<+<+>>]<<[->>+<<]>[>>>[-]<<<[-]]>[-]>[-]>[-<+<<+>>>]<<<[->>>+<<<]>+>
+[<<[-]+<<<[->>+>>>>>>>>>+<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<<<<<
+<<<<<<<<<<<[->>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<
+<<<<<<+>>>>>>>>>>>>>>>>>]<[<<<<<<<<[->>>>>>>>>+<<<+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]
+>+>>[<<<<<<<<<->>>>>>>[-]>>[-]]<<[<<<<<<[-]>>>>>>>[-]+<[-]]>-]<<<<<<<<[-]>>>>>>>
+>[-]<<<<<<<[->>>>>>>+<+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<<<<<<<+>>>>>>>>[>>[-]<<<<<<
+<<<<<<[->>>>>>>>>>>>+<<<+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<<<<<<<<<<<<<
+<[->>>>>>>>>>>>>>>>>>-<<<+<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<+>>>>>
+>>>>>>>>>>]<<[-]<<<<<<[->>>>>>+>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<<<<<<[-
+]>>>>>>>>[-]]<<<<<<<<[>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+<<<+<<
+<<<<<<<<<<<<<]>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>]<<<<<<<<<[->>>>>>
+>>>>>>-<<<+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<[-]<<<<<<<<<<<<[->>>>>>>>>
+>>>+>>+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<<<<<<<[-]]>
+[-]>[-]>[-]]<[>>>>>>>>[-]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<+<<<]>>>[-<<<+>>>]<
+<<<<<<<<[->>>>>>>>>>>>>>>>>>+<<<<<<<<<+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]
+>>>>[-]<<<<<<[->>>>>>+<<<<+<<]>>[-<<+>>]>[-]]>>[-]<<<<<<[-]>>>>>>>>>>>>[-<<<<<<<
+<<<<<+>>>>>>+>>>>>>]<<<<<<[->>>>>>+<<<<<<]<<<<<[-]>>>>>>[-<<<<<<+>>>>>+>]<[->+<]
+>>>>>>[-]<<<<<[-]<<<<<<<<-]>>>>>>>>++++++++++.[-]<<<[-]<<<<<<<<<<<<<[->>>>>>>>>>
+>>>+>+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<<<<<<<<<<<<[
+->>>>>>>>>>>+>+<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]<[->+<<+>]<[
+->+<]>>->[-]+<[-<<+<+>>>]<<<[->>>+<<<]>[>>>[-]<<<[-]]>>[-]<[-]>>[-<<+<+>>>]<<<[-
+>>>+<<<]>>+<[<[-]+<<<<<<<<<<<<<[->>>>>>>>>>>>+>>>>>>>+<<<<<<<<<<<<<<<<<<<]>>>>>>
+>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<[->>>>>>
+>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<+>>>>>>>>>>
+>>>>>>>]>[<<<<<<<<[->>>>>>>+<+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]>>>+<<[<<<<<<<->>>>>>
+>>>[-]<<[-]]>>[<<<<<<<<[-]>>>>>>>[-]+>[-]]<-]<<<<<<<<[-]>>>>>>>>[-]<<<<<<<[->>>>
+>>>+>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<<<<<<<<+>>>>>>>>[<<<[-]<<<<<<<<<<<<
+<<<<<[->>>>>>>>>>>>>>>>>+>>>>+<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>[-<<<<<
+<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>->>>>
++<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>
+>]>[-]<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<]>>>>>>
+>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<[-]>>>>>>>>[-
+]]<<<<<<<<[>>>>>[-]<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>+>>>>+<<<<<<<<<<<<<<<<<<<]>>>
+>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<[
+->>>>>>>>>>>>>>>>>->>>>+<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<
+<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>]>[-]<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>+<+
+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>]<<<
+<<<<<<[-]]>[-]>>[-]<[-]]>[>>[-]<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>+<<<<+<<<<<<<
+<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]<<<<<<<<<<<[->>>>>>>>>>>>>>>+<
+<<<+<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]>>>>>>>>>[-]<<<<<<<<<<<<<<<
+<<<<<<[->>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<+<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+
+>>>>>>>>>>>>]>>[-]]>[-]<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<+>
+>>>>>>>>>>>>>>>+>]<[->+<]<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<
+<<<<<<<+>>>>>>>>>>>>>>>+>>>>>>]<<<<<<[->>>>>>+<<<<<<]>[-]>>>>>[-]<<<<<<<<<<<<<[-
+]>[-]>[-]<<<<<<<<<<<<-]
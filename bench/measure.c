@@ -0,0 +1,71 @@
+//------------------------------------------------------------------------------
+// LIBRARIES
+//------------------------------------------------------------------------------
+
+#define _DEFAULT_SOURCE // wait4
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/resource.h>
+#include <sys/time.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+//------------------------------------------------------------------------------
+// FUNCTIONS
+//------------------------------------------------------------------------------
+
+static double wallSeconds(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+// Runs a command, with the standard input and output of this program, and
+// writes to the given file its wall time in seconds, its peak resident
+// memory in KiB and its exit status, separated by spaces
+int main(int argc, char *argv[])
+{
+    if (argc < 3)
+    {
+        fprintf(stderr, "[Usage] %s result.txt command [arguments]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    const double start = wallSeconds();
+    const pid_t pid = fork();
+    if (pid < 0)
+    {
+        perror("[Error]: Couldn't start the command");
+        return EXIT_FAILURE;
+    }
+    if (!pid)
+    {
+        execvp(argv[2], &argv[2]);
+        perror("[Error]: Couldn't run the command");
+        _exit(127);
+    }
+    int status;
+    struct rusage usage;
+    if (wait4(pid, &status, 0, &usage) < 0)
+    {
+        perror("[Error]: Couldn't wait for the command");
+        return EXIT_FAILURE;
+    }
+    const double seconds = wallSeconds() - start;
+    FILE *const file = fopen(argv[1], "w");
+    if (!file)
+    {
+        perror("[Error]: Couldn't write the result");
+        return EXIT_FAILURE;
+    }
+    // ru_maxrss is already in KiB on Linux
+    fprintf(file, "%.6f %ld %d\n", seconds, usage.ru_maxrss, WIFEXITED(status) ? WEXITSTATUS(status) : 128 + WTERMSIG(status));
+    fclose(file);
+    return EXIT_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// END
+//------------------------------------------------------------------------------
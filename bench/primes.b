@@ -0,0 +1,50 @@
+Prime numbers up to 2000
+
+Prints every prime number up to 2000 on its own line by trial division
+Numbers are kept in single cells: run it with 16 bits cells (cell bits=16)
+
+Written for the benchmark suite of this interpreter
+
+[-]++>[-]>>>++++++[-<+++++++>]<++[-<<+++++++++++++++++++++++++++++++++++++++++++
+++>>]<<++++++++++++++++++++>[-]+[>[-]++>[-]+>[-]<[>>[-]>[-]<<<<<<<[->>>>>>>>>+>>
+>+<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]<<<<<<<<<[->>>>>>>+>>+<<<
+<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<<[-<<+>>>->[-]+<[->>+>+<<<]>>>[-<<<+>>>]
+<[<[-]>[-]]<[<<<<<+>[-]<<<<[->>>>>>>+>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>
+]<[-]]<<][-]>[-]>[-]<<<[-]+<<[->>>>>+<<+<<<]>>>[-<<<+>>>]<<<<<<[->>>>>>>+<+<<<<<
+<]>>>>>>[-<<<<<<+>>>>>>]>[>[-<<+>>>>+<<]>>[-<<+>>]<+<<<[>>->[-]<<<[-]]>>>[<<<<[-
+]>>[-]+>>[-]]<<-]>[-]<[-]<<[->>+>>+<<<<]>>>>[-<<<<+>>>>]<+<[>>[-]+<<<<<[->>+>>>>
++<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<<<<[>>>[-]<<<[-]]>>>[-<<<+>>>>>+<<]>>[-<<+>>]<+<<
+<<[<<<<<[-]>>>>>>>>>[-]<<<<[-]]>>>>[<<<<<<<<<<+>>>>>>>>>>[-]]<[-]<[-]<[-]]>[<<<<
+<<[-]+<[-]>>>>>>>[-]]<<<<<<<]>[->>>>>>+<+<<<<<]>>>>>[-<<<<<+>>>>>]>[>>>>[-]<<<<<
+<<<<<<<<<<[->>>>>>>>>>>>>>>+>>>+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>[-<<<<<<<<<
+<<<<<<<<<+>>>>>>>>>>>>>>>>>>]<[-]++++++++++<[-]<<<<<<[-]>>>>>[->>>+>>>+<<<<<<]>>
+>>>>[-<<<<<<+>>>>>>]<<<<[->>+>>+<<<<]>>>>[-<<<<+>>>>]<<<[-<<<<<<<<+>>>>>>>>>->[-
+]+<[->>+>+<<<]>>>[-<<<+>>>]<[<[-]>[-]]<[<<<<+<<<<<<[-]>>>>>>>[->>+>>+<<<<]>>>>[-
+<<<<+>>>>]<[-]]<<][-]>[-]>[-]<<<<<[-]>[-<+>>>>>+<<<<]>>>>[-<<<<+>>>>]<<<<[-][-]<
+<<<[-]>>>[->>>>>+>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<<<<[->>+>>+<<<<]>>>>[-<<<<+>>>>
+]<[-<<<<<<<<+>>>>>>>-<[-]+>[->>+>+<<<]>>>[-<<<+>>>]<[<<<[-]>>>[-]]<<<[<<+<<<<[-]
+>>>>>[->>+>>+<<<<]>>>>[-<<<<+>>>>]<<<[-]]>>][-]<[-]<[-]<<<[-]>[-<+>>>+<<]>>[-<<+
+>>]<<[-][-]<<<[-]>>[->>>+>>>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<<<<[->>+>>+<<<<]>>>>[
+-<<<<+>>>>]<<<[-<<<<<+>>>>>>->[-]+<[->>+>+<<<]>>>[-<<<+>>>]<[<[-]>[-]]<[<<<<+<<<
+[-]>>>>[->>+>>+<<<<]>>>>[-<<<<+>>>>]<[-]]<<][-]>[-]>[-]<<<<<[-]>[-<+>>>>>+<<<<]>
+>>>[-<<<<+>>>>]<<<<[-][-]<<<<<<<[-]>>>>>>[->>>>>+>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]
+<<<<[->>+>>+<<<<]>>>>[-<<<<+>>>>]<[-<<<<<<<<<<<+>>>>>>>>>>-<[-]+>[->>+>+<<<]>>>[
+-<<<+>>>]<[<<<[-]>>>[-]]<<<[<<+<<<<<<<[-]>>>>>>>>[->>+>>+<<<<]>>>>[-<<<<+>>>>]<<
+<[-]]>>][-]<[-]<[-]<<<[-]>[-<+>>>+<<]>>[-<<+>>]<<[-][-]<<[-]>[->>>+>>>+<<<<<<]>>
+>>>>[-<<<<<<+>>>>>>]<<<<[->>+>>+<<<<]>>>>[-<<<<+>>>>]<<<[-<<<<+>>>>>->[-]+<[->>+
+>+<<<]>>>[-<<<+>>>]<[<[-]>[-]]<[<<<<+<<[-]>>>[->>+>>+<<<<]>>>>[-<<<<+>>>>]<[-]]<
+<][-]>[-]>[-]<<<<<[-]>[-<+>>>>>+<<<<]>>>>[-<<<<+>>>>]<<<<[-]<<[->>>>>+<+<<<<]>>>
+>[-<<<<+>>>>]>[>[-]+<[-]]>[-<+<+>>]<<[->>+<<]>[<++++++[-<<<<++++++++>>>>]<<<<.>>
+>>++++++[-<<<<-------->>>>]<<<<>>>>>[-]]<<<<<<<<<<[->>>>>>>>>>+<+<<<<<<<<<]>>>>>
+>>>>[-<<<<<<<<<+>>>>>>>>>]>[>[-]+<[-]]>[-<+<+>>]<<[->>+<<]>[<++++++[-<<<<<<<<<++
+++++++>>>>>>>>>]<<<<<<<<<.>>>>>>>>>++++++[-<<<<<<<<<-------->>>>>>>>>]<<<<<<<<<>
+>>>>>>>>>[-]]<<<<<<[->>>>>>+<+<<<<<]>>>>>[-<<<<<+>>>>>]>[>[-]+<[-]]>[-<+<+>>]<<[
+->>+<<]>[<++++++[-<<<<<++++++++>>>>>]<<<<<.>>>>>++++++[-<<<<<-------->>>>>]<<<<<
+>>>>>>[-]]<<<<<<<[->>>>>>>+<+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]>[>[-]+<[-]]>[-<+<+>>]
+<<[->>+<<]>[<++++++[-<<<<<<++++++++>>>>>>]<<<<<<.>>>>>>++++++[-<<<<<<-------->>>
+>>>]<<<<<<>>>>>>>[-]]>[-]+[-<+<+>>]<<[->>+<<]>[<++++++[-<<<<<<<<++++++++>>>>>>>>
+]<<<<<<<<.>>>>>>>>++++++[-<<<<<<<<-------->>>>>>>>]<<<<<<<<>>>>>>>>>[-]]<<<<[-]>
+[-]>[-]>>>[-]<<<<<<<<<<[-]>>[-]>[-]<<<<[-]>>>>>[-]++++++++++.[-]<<<[-]]<<<<<<<<[
+-]>[-]>[-]>[-]>[-]>[-]<<<<<<<<+>>[-]+<[->>>>>>>+<<+<<<<<]>>>>>[-<<<<<+>>>>>]<<<<
+<<[->>>>>>>+<+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]>[>[-<<+<<+>>>>]<<<<[->>>>+<<<<]>+>[>
+>-<<<[-]>[-]]<[<<<[-]>>>>>[-]+<<[-]]>>-]>[-]<[-]<<<<<]
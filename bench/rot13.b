@@ -0,0 +1,29 @@
+ROT13 filter
+
+Replaces every letter of the input by the one 13 places further in the
+alphabet and copies the other characters: it stops at the end of the
+input which must read as 0 (eof=0)
+
+Written for the benchmark suite of this interpreter
+
+>[-]>+++++[-<+++++>]<>[-]>+++++[-<+++++>]<+<<,[>>>[-]<<<[->>>+>>+<<<<<]>>>>>[-<<
+<<<+>>>>>]++++++++[-<<-------->>]<<->[-]+<<<[->>>>+>>+<<<<<<]>>>>>>[-<<<<<<+>>>>
+>>]<<<<[->>>+>+<<<<]>>>>[-<<<<+>>>>]<[<[->>+>>+<<<<]>>>>[-<<<<+>>>>]<+<[<<->>>[-
+]<[-]]>[<<<<[-]>>[-]+>>[-]]<<-]<[-]>[-]<<[->>+>>+<<<<]>>>>[-<<<<+>>>>]<<<+>[>>[-
+]<<<<<<<<[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]+++++++[-<-------
+>]<---<[-]+>[->+>>+<<<]>>>[-<<<+>>>]<<<<<<<<<[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<
+<<<<<<<<+>>>>>>>>>]<[<[->>+>>+<<<<]>>>>[-<<<<+>>>>]<+<[<<->>>[-]<[-]]>[<<<<<[-]>
+>>[-]+>>[-]]<<-]<[-]>[-]<<<[->>>+<+<<]>>[-<<+>>]>[<+++++[-<----->]<->>[-]]<<<<<<
+<<<<[-]>>>>>>>>[-<<<<<<<<+>>>>>>>>>>+<<]>>[-<<+>>]++++++++[-<<<<<<<<<<++++++++>>
+>>>>>>>>]<<<<<<<<<<+>>>>>>>>[-]<[-]<<[-]>[-]]<[>>[-]<<<<<<<[->>>>>>>+>>>+<<<<<<<
+<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]+++++++++[-<<<---------->>>]<<<------->[-]
++<<<<<<<[->>>>>>>>>+>>+<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<<<<[->
+>+>>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<<[>[->>+>+<<<]>>>[-<<<+>>>]<<+>[<<->[-]>[-]]<[<
+<<[-]>[-]+>>[-]]<<-]>[-]<[-]<[->+>+<<]>>[-<<+>>]<[>[-]<<<<<<<<<<[->>>>>>>>>>+>>+
+<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]+++++++++[-<<--------->>]<<
+--->[-]+<[->>+>>+<<<<]>>>>[-<<<<+>>>>]<<<<<<<<<<<<[->>>>>>>>>>>+>+<<<<<<<<<<<<]>
+>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]<[<[->>+>>+<<<<]>>>>[-<<<<+>>>>]<+<[<<->>
+>[-]<[-]]>[<<<<[-]>>[-]+>>[-]]<<-]<[-]>[-]<<[->>+<+<]>[-<+>]>[<+++++[-<<----->>]
+<<->>>[-]]<<<<<<<<<<<<<[-]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>>>>+<<<]>>>[-<<<+>>>]
++++++++++[-<<<<<<<<<<<<<++++++++++>>>>>>>>>>>>>]<<<<<<<<<<<<<+++++++>>>>>>>>>>[-
+]>[-]<<[-]]<<[-]>[-]<<<[-]]<<[-]>[-]<<<<.,]
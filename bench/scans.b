@@ -0,0 +1,12 @@
+Scans
+
+Builds a row of 200 cells and crosses it from end to end with scan loops
+that move one cell at a time: its loop body holds 16 scans one after the
+other so every scan is its own operation and it prints A at the end
+
+Written for the benchmark suite of this interpreter
+
+++++++++++[>++++++++++++++++++++<-]>[>>[>]+<[<]<-]<+++++++++++++++++++++++++++++
++++++++++++++++++++++++++++++++++++[>-[>>[>]<[<]<>>[>]<[<]<>>[>]<[<]<>>[>]<[<]<>
+>[>]<[<]<>>[>]<[<]<>>[>]<[<]<>>[>]<[<]<-]<-]>>>+++++++++++++++++++++++++++++++++
++++++++++++++++++++++++++++++++.[-]++++++++++.
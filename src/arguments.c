@@ -115,11 +115,12 @@ static int isCommand(const char *const arg, const struct ArgCmd *const command)
     const size_t length = strlen(arg);
     if (command->parameter)
     {
-        if (!strncmp(arg, command->cmd, command->cmdLength))
+        // the parameter follows the =, so --batch doesn't match --batch-output
+        if (!strncmp(arg, command->cmd, command->cmdLength) && arg[command->cmdLength] == '=')
         {
             return TRUE;
         }
-        else if (command->alias && !strncmp(arg, command->alias, command->aliasLength))
+        else if (command->alias && !strncmp(arg, command->alias, command->aliasLength) && arg[command->aliasLength] == '=')
         {
             return TRUE;
         }
@@ -0,0 +1,439 @@
+//------------------------------------------------------------------------------
+// LIBRARIES
+//------------------------------------------------------------------------------
+
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#include "batch.h"
+#include "io.h"
+
+//------------------------------------------------------------------------------
+// DEFINITIONS
+//------------------------------------------------------------------------------
+
+#define LIST_CHUNK_SIZE (64 * 1024)
+#define NO_JOB UINT_MAX
+
+//------------------------------------------------------------------------------
+// USER TYPES
+//------------------------------------------------------------------------------
+
+// One input of the batch, and the state of its run
+struct Job
+{
+    const char *inputName;
+    int inputFd;
+    // -1 when the output is kept in memory, until the outputs of the
+    // previous inputs are written
+    int outputFd;
+    unsigned char *output;
+    size_t outputSize;
+    size_t outputCapacity;
+    int done;
+    int failed;
+};
+
+// Inputs not taken yet: the owner of the queue takes them from the front, in
+// order, and the other workers steal them from the back when they are idle
+struct Queue
+{
+    pthread_mutex_t lock;
+    unsigned int first;
+    unsigned int last;
+};
+
+struct Batch
+{
+    const struct Program *program;
+    const struct Options *options;
+    // limits of each input
+    const struct Budget *budget;
+    enum BatchOutput batchOutput;
+    struct Job *jobs;
+    unsigned int jobNum;
+    struct Queue *queues;
+    unsigned int queueNum;
+    // the outputs and the error messages are written by one worker at a time
+    pthread_mutex_t outputLock;
+    unsigned int nextOutput;
+};
+
+struct Worker
+{
+    struct Batch *batch;
+    unsigned int id;
+    pthread_t thread;
+};
+
+//------------------------------------------------------------------------------
+// FUNCTIONS
+//------------------------------------------------------------------------------
+
+// Reads the whole list of inputs, from a file or from the standard input if
+// the name is -, as a null terminated string
+static char *readList(const char *const listName)
+{
+    const int useStdin = !strcmp(listName, "-");
+    const int fd = useStdin ? STDIN_FILENO : open(listName, O_RDONLY);
+    if (fd < 0)
+    {
+        return NULL;
+    }
+    char *text = NULL;
+    size_t size = 0;
+    size_t capacity = 0;
+    for (;;)
+    {
+        if (size + LIST_CHUNK_SIZE + 1 > capacity)
+        {
+            capacity = 2 * (size + LIST_CHUNK_SIZE + 1);
+            char *newText = (char *)realloc((void *)text, capacity);
+            if (!newText)
+            {
+                free((void *)text);
+                text = NULL;
+                break;
+            }
+            text = newText;
+        }
+        const ssize_t length = read(fd, text + size, LIST_CHUNK_SIZE);
+        if (length < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (length < 0)
+        {
+            free((void *)text);
+            text = NULL;
+            break;
+        }
+        if (!length)
+        {
+            text[size] = '\0';
+            break;
+        }
+        size += length;
+    }
+    if (!useStdin)
+    {
+        const int error = errno;
+        close(fd);
+        errno = error;
+    }
+    return text;
+}
+
+// One job per non empty line of the list, whose names point into the list
+static struct Job *splitList(char *const text, unsigned int *const jobNum)
+{
+    unsigned int lines = 1;
+    for (const char *ptr = text; *ptr; ptr++)
+    {
+        lines += (*ptr == '\n');
+    }
+    struct Job *jobs = (struct Job *)calloc(lines, sizeof(struct Job));
+    if (!jobs)
+    {
+        return NULL;
+    }
+    *jobNum = 0;
+    for (char *line = text; line;)
+    {
+        char *const end = strchr(line, '\n');
+        if (end)
+        {
+            *end = '\0';
+        }
+        if (*line)
+        {
+            jobs[*jobNum].inputName = line;
+            jobs[*jobNum].outputFd = -1;
+            (*jobNum)++;
+        }
+        line = end ? end + 1 : NULL;
+    }
+    return jobs;
+}
+
+static unsigned int takeJob(struct Batch *const batch, const unsigned int id)
+{
+    for (unsigned int visited = 0; visited < batch->queueNum; visited++)
+    {
+        struct Queue *const queue = &batch->queues[(id + visited) % batch->queueNum];
+        unsigned int jobIdx = NO_JOB;
+        pthread_mutex_lock(&queue->lock);
+        if (queue->first < queue->last)
+        {
+            jobIdx = visited ? --queue->last : queue->first++;
+        }
+        pthread_mutex_unlock(&queue->lock);
+        if (jobIdx != NO_JOB)
+        {
+            return jobIdx;
+        }
+    }
+    return NO_JOB;
+}
+
+static size_t readJob(void *user, unsigned char *data, size_t size)
+{
+    struct Job *const job = (struct Job *)user;
+    return readDescriptor(&job->inputFd, data, size);
+}
+
+static size_t writeJob(void *user, const unsigned char *data, size_t size)
+{
+    struct Job *const job = (struct Job *)user;
+    if (job->outputFd >= 0)
+    {
+        return writeDescriptor(&job->outputFd, data, size);
+    }
+    if (job->outputSize + size > job->outputCapacity)
+    {
+        const size_t capacity = 2 * (job->outputSize + size);
+        unsigned char *output = (unsigned char *)realloc((void *)job->output, capacity);
+        if (!output)
+        {
+            return 0;
+        }
+        job->output = output;
+        job->outputCapacity = capacity;
+    }
+    memcpy(&job->output[job->outputSize], data, size);
+    job->outputSize += size;
+    return size;
+}
+
+static size_t writevJob(void *user, const struct iovec *vectors, int vectorNum)
+{
+    struct Job *const job = (struct Job *)user;
+    if (job->outputFd >= 0)
+    {
+        return writevDescriptor(&job->outputFd, vectors, vectorNum);
+    }
+    size_t written = 0;
+    for (int vectorIdx = 0; vectorIdx < vectorNum; vectorIdx++)
+    {
+        written += writeJob(user, (const unsigned char *)vectors[vectorIdx].iov_base, vectors[vectorIdx].iov_len);
+    }
+    return written;
+}
+
+static void jobError(struct Batch *const batch, const struct Job *const job, const char *const msg)
+{
+    pthread_mutex_lock(&batch->outputLock);
+    fprintf(stderr, "\n[Error in %s]: %s\n", job->inputName, msg);
+    pthread_mutex_unlock(&batch->outputLock);
+}
+
+static int openOutputFile(struct Job *const job)
+{
+    char *const outputName = (char *)malloc(strlen(job->inputName) + sizeof(".out"));
+    if (!outputName)
+    {
+        return EXIT_FAILURE;
+    }
+    sprintf(outputName, "%s.out", job->inputName);
+    job->outputFd = open(outputName, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    free((void *)outputName);
+    return job->outputFd < 0 ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+// The environment of the worker is created by its first job, and reused by
+// the next ones, with its tape and its translation of the program
+static int runJob(struct Batch *const batch, struct Environment **const env, struct Job *const job)
+{
+    job->inputFd = open(job->inputName, O_RDONLY);
+    if (job->inputFd < 0)
+    {
+        jobError(batch, job, strerror(errno));
+        return EXIT_FAILURE;
+    }
+    if (batch->batchOutput == batchFiles && openOutputFile(job))
+    {
+        jobError(batch, job, strerror(errno));
+        close(job->inputFd);
+        return EXIT_FAILURE;
+    }
+    const struct Io io = {
+        .read = readJob,
+        .write = writeJob,
+        .writev = writevJob,
+        .user = job,
+        .lineBuffered = 0,
+    };
+    int result = EXIT_SUCCESS;
+    if (*env ? resetEnvironment(*env, &io) : !(*env = newEnvironment(batch->program, batch->options, &io)))
+    {
+        jobError(batch, job, "Couldn't allocate the program memory");
+        result = EXIT_FAILURE;
+    }
+    else
+    {
+        const enum RunStatus status = runEnvironment(*env, batch->budget);
+        unsigned int line, col;
+        if (status == runError)
+        {
+            const char *const msg = environmentError(*env, &line, &col);
+            pthread_mutex_lock(&batch->outputLock);
+            fprintf(stderr, "\n[Error in %s, line %u, column %u]: %s\n", job->inputName, line, col, msg);
+            pthread_mutex_unlock(&batch->outputLock);
+            result = EXIT_FAILURE;
+        }
+        else if (status == runStopped)
+        {
+            const enum StopReason reason = environmentStop(*env, &line, &col);
+            pthread_mutex_lock(&batch->outputLock);
+            fprintf(stderr, "\n[Stopped in %s, line %u, column %u]: %s\n", job->inputName, line, col, stopMessage(reason));
+            pthread_mutex_unlock(&batch->outputLock);
+            result = EXIT_FAILURE;
+        }
+    }
+    close(job->inputFd);
+    if (job->outputFd >= 0)
+    {
+        close(job->outputFd);
+    }
+    return result;
+}
+
+// Writes the outputs kept in memory that are next in order
+static void finishJob(struct Batch *const batch, const unsigned int jobIdx)
+{
+    pthread_mutex_lock(&batch->outputLock);
+    batch->jobs[jobIdx].done = 1;
+    for (; batch->nextOutput < batch->jobNum && batch->jobs[batch->nextOutput].done; batch->nextOutput++)
+    {
+        struct Job *const job = &batch->jobs[batch->nextOutput];
+        if (batch->batchOutput == batchStream)
+        {
+            writeStandardOutput(NULL, (const unsigned char *)"==> ", 4);
+            writeStandardOutput(NULL, (const unsigned char *)job->inputName, strlen(job->inputName));
+            writeStandardOutput(NULL, (const unsigned char *)" <==\n", 5);
+            writeStandardOutput(NULL, job->output, job->outputSize);
+        }
+        free((void *)job->output);
+        job->output = NULL;
+    }
+    pthread_mutex_unlock(&batch->outputLock);
+}
+
+static void *runWorker(void *arg)
+{
+    struct Worker *const worker = (struct Worker *)arg;
+    struct Batch *const batch = worker->batch;
+    struct Environment *env = NULL;
+    for (unsigned int jobIdx = takeJob(batch, worker->id); jobIdx != NO_JOB; jobIdx = takeJob(batch, worker->id))
+    {
+        batch->jobs[jobIdx].failed = runJob(batch, &env, &batch->jobs[jobIdx]);
+        finishJob(batch, jobIdx);
+    }
+    freeEnvironment(env);
+    return NULL;
+}
+
+static int runWorkers(struct Batch *const batch)
+{
+    struct Worker *workers = (struct Worker *)malloc(batch->queueNum * sizeof(struct Worker));
+    if (!workers)
+    {
+        return EXIT_FAILURE;
+    }
+    for (unsigned int id = 0; id < batch->queueNum; id++)
+    {
+        struct Queue *const queue = &batch->queues[id];
+        pthread_mutex_init(&queue->lock, NULL);
+        queue->first = (unsigned int)((unsigned long long)batch->jobNum * id / batch->queueNum);
+        queue->last = (unsigned int)((unsigned long long)batch->jobNum * (id + 1) / batch->queueNum);
+        workers[id] = (struct Worker){.batch = batch, .id = id};
+    }
+    // the main thread is the first worker, and the jobs of the threads that
+    // couldn't be created are stolen by the others
+    unsigned int started = 1;
+    for (unsigned int id = 1; id < batch->queueNum; id++)
+    {
+        if (!pthread_create(&workers[id].thread, NULL, runWorker, (void *)&workers[id]))
+        {
+            workers[started++] = workers[id];
+        }
+    }
+    runWorker((void *)&workers[0]);
+    for (unsigned int id = 1; id < started; id++)
+    {
+        pthread_join(workers[id].thread, NULL);
+    }
+    for (unsigned int id = 0; id < batch->queueNum; id++)
+    {
+        pthread_mutex_destroy(&batch->queues[id].lock);
+    }
+    free((void *)workers);
+    return EXIT_SUCCESS;
+}
+
+// Runs the program once for every input file named in the list, one per line,
+// on threadNum threads (0 for one per processor). The program is shared by
+// all the threads, as it is never modified.
+int runBatch(const struct Program *const program, const struct Options *const options, const struct Budget *const budget, const char *const listName, const unsigned int threadNum, const enum BatchOutput batchOutput)
+{
+    char *const text = readList(listName);
+    if (!text)
+    {
+        fprintf(stderr, "\n[Error]: Couldn't read the file %s: %s\n", listName, strerror(errno));
+        return EXIT_FAILURE;
+    }
+    struct Batch batch = {
+        .program = program,
+        .options = options,
+        .budget = budget,
+        .batchOutput = batchOutput,
+        .jobs = NULL,
+        .jobNum = 0,
+        .queues = NULL,
+        .queueNum = threadNum,
+        .nextOutput = 0,
+    };
+    if (!batch.queueNum)
+    {
+        const long processors = sysconf(_SC_NPROCESSORS_ONLN);
+        batch.queueNum = processors > 0 ? (unsigned int)processors : 1;
+    }
+    int result = EXIT_FAILURE;
+    batch.jobs = splitList(text, &batch.jobNum);
+    if (batch.jobs)
+    {
+        if (batch.queueNum > batch.jobNum)
+        {
+            batch.queueNum = batch.jobNum ? batch.jobNum : 1;
+        }
+        batch.queues = (struct Queue *)malloc(batch.queueNum * sizeof(struct Queue));
+    }
+    if (batch.queues)
+    {
+        pthread_mutex_init(&batch.outputLock, NULL);
+        result = runWorkers(&batch);
+        pthread_mutex_destroy(&batch.outputLock);
+    }
+    if (result)
+    {
+        fprintf(stderr, "\n[Error]: Couldn't start the batch: out of memory\n");
+    }
+    for (unsigned int jobIdx = 0; jobIdx < batch.jobNum && !result; jobIdx++)
+    {
+        result = batch.jobs[jobIdx].failed;
+    }
+    free((void *)batch.queues);
+    free((void *)batch.jobs);
+    free((void *)text);
+    return result;
+}
+
+//------------------------------------------------------------------------------
+// END
+//------------------------------------------------------------------------------
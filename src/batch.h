@@ -0,0 +1,33 @@
+#ifndef __BATCH
+#define __BATCH
+
+//------------------------------------------------------------------------------
+// LIBRARIES
+//------------------------------------------------------------------------------
+
+#include "brainfuck.h"
+
+//------------------------------------------------------------------------------
+// USER TYPES
+//------------------------------------------------------------------------------
+
+// Where the outputs of the inputs of a batch are written
+enum BatchOutput
+{
+    // to the standard output, in the order of the inputs, each one after a
+    // line with the name of its input
+    batchStream = 0,
+    // to a file next to each input, with the .out extension
+    batchFiles,
+};
+
+//------------------------------------------------------------------------------
+// FUNCTION PROTOTYPES
+//------------------------------------------------------------------------------
+
+int runBatch(const struct Program *const program, const struct Options *const options, const struct Budget *const budget, const char *const listName, const unsigned int threadNum, const enum BatchOutput batchOutput);
+
+//------------------------------------------------------------------------------
+// END
+//------------------------------------------------------------------------------
+#endif // __BATCH
@@ -0,0 +1,306 @@
+//------------------------------------------------------------------------------
+// LIBRARIES
+//------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "brainfuck.h"
+#include "parser.h"
+#include "engine.h"
+#include "jit.h"
+#include "tape.h"
+#include "profile.h"
+#include "trace.h"
+#include "snapshot.h"
+#include "prefix.h"
+#include "io.h"
+
+//------------------------------------------------------------------------------
+// FUNCTIONS
+//------------------------------------------------------------------------------
+
+void defaultOptions(struct Options *const options)
+{
+    *options = (struct Options){
+        .memorySize = 30000,
+        .cellBits = 8,
+        .tapeMode = tapeFixed,
+        .engine = engineThreaded,
+        .eofMode = eofMinusOne,
+        .debugMode = 0,
+        .profileMode = 0,
+        .snapshotMode = 0,
+    };
+}
+
+// The engines are picked from tables indexed by the options, so the values
+// outside of them are refused
+static int validOptions(const struct Options *const options)
+{
+    return (options->cellBits == 8 || options->cellBits == 16 || options->cellBits == 32) &&
+           (unsigned int)options->tapeMode <= tapeSparse && (unsigned int)options->engine <= engineJit &&
+           (unsigned int)options->eofMode <= eofUnchanged;
+}
+
+// Returns NULL if the options are invalid or the memory can't be allocated
+struct Environment *newEnvironment(const struct Program *const program, const struct Options *const options, const struct Io *const io)
+{
+    if (!validOptions(options))
+    {
+        return NULL;
+    }
+    struct Environment *env = (struct Environment *)calloc(1, sizeof(struct Environment));
+    if (!env)
+    {
+        return NULL;
+    }
+    env->program = program;
+    env->op = program->ops;
+    env->options = *options;
+    initOutput(&env->output, io);
+    initInput(&env->input, io, options->eofMode, &env->output);
+    if (options->profileMode && !(env->profile = newProfile(program)))
+    {
+        free((void *)env);
+        return NULL;
+    }
+    if (newTape(env))
+    {
+        freeProfile(env->profile);
+        free((void *)env);
+        return NULL;
+    }
+    applyPrefix(env);
+    return env;
+}
+
+// Prepares the environment to run its program again from the start, with
+// other input/output callbacks. The memory of the tape and the translation
+// of the program are reused.
+int resetEnvironment(struct Environment *const env, const struct Io *const io)
+{
+    env->op = env->program->ops;
+    env->countdown = 0;
+    env->steps = 0;
+    env->stopRequest = stopNone;
+    env->stopReason = stopNone;
+    env->error = NULL;
+    initOutput(&env->output, io);
+    initInput(&env->input, io, env->options.eofMode, &env->output);
+    // the last snapshot doesn't hold the state of this program anymore
+    freeSnapshot(env->snapshot);
+    env->snapshot = NULL;
+    env->prefix = NULL;
+    if (resetTape(env))
+    {
+        return EXIT_FAILURE;
+    }
+    applyPrefix(env);
+    return EXIT_SUCCESS;
+}
+
+void freeEnvironment(struct Environment *const env)
+{
+    if (env)
+    {
+        freeTape(env);
+        freeJit(env->jit);
+        freeProfile(env->profile);
+        stopTrace(env->trace);
+        freeSnapshot(env->snapshot);
+        free((void *)env);
+    }
+}
+
+// Runs the program until it ends, fails or the budget runs out. A stopped
+// program continues from where it was on the next run, with a new budget.
+enum RunStatus runEnvironment(struct Environment *const env, const struct Budget *const budget)
+{
+    static const EngineFunction engines[] = {
+        [engineReference] = runReference,
+        [engineSwitch] = runSwitch,
+        [engineThreaded] = runThreaded,
+        [engineJit] = runJit,
+    };
+    env->stopReason = stopNone;
+    if (env->error)
+    {
+        return runError;
+    }
+    if (env->op->code == opEnd && !env->prefix)
+    {
+        return runFinished;
+    }
+    startBudget(env, budget);
+    enum RunStatus status;
+    if (env->profile)
+    {
+        // the profiler has its own engine, which counts the operations
+        startProfile(env->profile);
+        status = runOnTape(env, runProfile);
+        stopProfile(env->profile);
+    }
+    else if (env->trace)
+    {
+        // so does the trace, which records them, and the writer gets the
+        // records of every run
+        status = runOnTape(env, runTrace);
+        flushTrace(env->trace);
+    }
+    else
+    {
+        status = runOnTape(env, engines[env->options.engine]);
+    }
+    flushOutput(&env->output);
+    if (status == runFinished && env->output.truncated)
+    {
+        // the end of the output was discarded
+        env->stopReason = stopOutput;
+        status = runStopped;
+    }
+    return status;
+}
+
+// Stops the run at the next check of the budget. Unlike the other functions,
+// it can be called from another thread or a signal handler.
+void interruptEnvironment(struct Environment *const env)
+{
+    stopEnvironment(env, stopInterrupted);
+}
+
+// Same as interruptEnvironment(), with the reason reported by the run, so a
+// watchdog can enforce its own limits
+void stopEnvironment(struct Environment *const env, const enum StopReason reason)
+{
+    env->stopRequest = reason;
+}
+
+// Why the last run stopped, or stopNone, and the location where the program
+// continues
+enum StopReason environmentStop(const struct Environment *const env, unsigned int *const line, unsigned int *const col)
+{
+    if (env->stopReason != stopNone)
+    {
+        const struct Location location = opLocation(env->program, env->op - env->program->ops);
+        if (line)
+        {
+            *line = location.line;
+        }
+        if (col)
+        {
+            *col = location.col;
+        }
+    }
+    return env->stopReason;
+}
+
+const char *stopMessage(const enum StopReason reason)
+{
+    static const char *const messages[] = {
+        [stopNone] = "The program didn't stop",
+        [stopInterrupted] = "The program was interrupted",
+        [stopSteps] = "Step limit reached",
+        [stopTime] = "Time limit reached",
+        [stopOutput] = "Output limit reached",
+    };
+    return messages[reason];
+}
+
+void printEnvironmentStop(const struct Environment *const env)
+{
+    unsigned int line, col;
+    const enum StopReason reason = environmentStop(env, &line, &col);
+    if (reason != stopNone)
+    {
+        fprintf(stderr, "\n[Stopped in line %u, column %u]: %s\n", line, col, stopMessage(reason));
+        codeExcerpt(env->program, env->op - env->program->ops);
+    }
+}
+
+// Message of the runtime error, or NULL, and its location in the source code
+const char *environmentError(const struct Environment *const env, unsigned int *const line, unsigned int *const col)
+{
+    if (env->error)
+    {
+        const struct Location location = opLocation(env->program, env->op - env->program->ops);
+        if (line)
+        {
+            *line = location.line;
+        }
+        if (col)
+        {
+            *col = location.col;
+        }
+    }
+    return env->error;
+}
+
+void printEnvironmentError(const struct Environment *const env)
+{
+    if (env->error)
+    {
+        codeError(env->program, env->op - env->program->ops, env->error);
+    }
+}
+
+void environmentUsage(const struct Environment *const env, struct Usage *const usage)
+{
+    // the iterations of the countdown are counted in advance
+    usage->steps = env->steps - env->countdown;
+    usage->inputBytes = env->input.offset + env->input.position + env->input.skip;
+    usage->outputBytes = env->output.written;
+}
+
+// Checkpoint of a program between two runs, in a file that can be restored
+// by another process. The functions return NULL, or a message if they fail.
+const char *saveEnvironment(struct Environment *const env, const char *const fileName, const int incremental)
+{
+    return writeSnapshot(env, fileName, incremental);
+}
+
+// The environment must have the options of the one saved, and the same input
+// from its start: the part consumed before the snapshot is skipped
+const char *restoreEnvironment(struct Environment *const env, const char *const fileName)
+{
+    return readSnapshot(env, fileName);
+}
+
+// Hot spot report of the runs so far, only in profile mode
+void printEnvironmentProfile(const struct Environment *const env)
+{
+    if (env->profile)
+    {
+        printProfile(env->profile);
+    }
+}
+
+// Records the operations of the next runs, chosen by the filter (or all of
+// them if it is NULL), to the given file, with the cell under the pointer
+// before they run. A NULL file name stops the trace. Both return NULL, or a
+// message if they fail. The normal engines don't pay for the trace: the runs
+// traced use an engine of their own, whatever the options say.
+const char *traceEnvironment(struct Environment *const env, const char *const fileName, const struct TraceFilter *const filter)
+{
+    const char *const msg = stopTrace(env->trace);
+    env->trace = NULL;
+    if (msg || !fileName)
+    {
+        return msg;
+    }
+    if (env->profile)
+    {
+        return "The environment is in profile mode";
+    }
+    return startTrace(&env->trace, env->program, fileName, filter);
+}
+
+// Prints the records of a trace file on the standard output, with the
+// locations of the operations in the program traced
+const char *printTrace(const struct Program *const program, const char *const fileName)
+{
+    return decodeTrace(program, fileName);
+}
+
+//------------------------------------------------------------------------------
+// END
+//------------------------------------------------------------------------------
@@ -0,0 +1,167 @@
+#ifndef __BRAINFUCK
+#define __BRAINFUCK
+
+//------------------------------------------------------------------------------
+// LIBRARIES
+//------------------------------------------------------------------------------
+
+#include <stddef.h>
+
+//------------------------------------------------------------------------------
+// USER TYPES
+//------------------------------------------------------------------------------
+
+// Library interface: a program is compiled once with loadBrainFuck(), into a
+// handle that is never modified, so any number of environments can run it at
+// the same time, each one with its own options, memory and input/output.
+// Nothing is shared between the environments.
+
+enum Engine
+{
+    engineReference = 0,
+    engineSwitch,
+    engineThreaded,
+    engineJit,
+};
+
+enum TapeMode
+{
+    // memorySize cells, every move is checked
+    tapeFixed = 0,
+    // grows in both directions, the moves out of the tape are caught by guard pages
+    tapeUnbounded,
+    // memorySize cells, checked as the fixed tape, in pages that are only
+    // allocated when written
+    tapeSparse,
+};
+
+// Value stored in the cell by the , command at the end of the input
+enum EofMode
+{
+    eofMinusOne = 0,
+    eofZero,
+    eofUnchanged,
+};
+
+enum RunStatus
+{
+    runFinished = 0,
+    runError,
+    // the budget ran out, the program continues from there on the next run
+    runStopped,
+};
+
+// Why the last run returned runStopped
+enum StopReason
+{
+    stopNone = 0,
+    // by interruptEnvironment()
+    stopInterrupted,
+    stopSteps,
+    stopTime,
+    // the output beyond the limit was discarded
+    stopOutput,
+};
+
+struct Options
+{
+    // cells of the fixed and sparse tapes
+    unsigned int memorySize;
+    // 8, 16 or 32
+    unsigned int cellBits;
+    enum TapeMode tapeMode;
+    enum Engine engine;
+    enum EofMode eofMode;
+    // enables the # and @ commands
+    int debugMode;
+    // counts the operations and samples the time of every run, whatever the
+    // engine, for printEnvironmentProfile()
+    int profileMode;
+    // allows saveEnvironment(), the JIT then keeps track of the cells reached
+    int snapshotMode;
+};
+
+// Both return the number of bytes transferred: read returns 0 at the end of
+// the input, and write less than size if the output is gone
+typedef size_t (*ReadCallback)(void *user, unsigned char *data, size_t size);
+typedef size_t (*WriteCallback)(void *user, const unsigned char *data, size_t size);
+// Writes the vectors in order, like writev(), and returns the number of bytes
+// written in total
+struct iovec;
+typedef size_t (*WritevCallback)(void *user, const struct iovec *vectors, int vectorNum);
+
+struct Io
+{
+    ReadCallback read;
+    WriteCallback write;
+    // optional, lets a large block go out with the buffered output in a
+    // single call
+    WritevCallback writev;
+    void *user;
+    // the output is flushed at every newline, instead of when the buffer is full
+    int lineBuffered;
+};
+
+// Limits of a run, 0 means unlimited. Steps are loop iterations, which every
+// program that doesn't end must go through.
+struct Budget
+{
+    unsigned long long steps;
+    unsigned long long milliseconds;
+    unsigned long long outputBytes;
+};
+
+// Totals of an environment since its program started, the runs before its
+// snapshot included
+struct Usage
+{
+    // loop iterations
+    unsigned long long steps;
+    unsigned long long inputBytes;
+    unsigned long long outputBytes;
+};
+
+// Operations recorded by traceEnvironment(): the ones compiled from the source
+// lines [firstLine, lastLine], while the loop iterations run so far are in
+// [firstStep, lastStep]. A last line or step of 0 means no limit.
+struct TraceFilter
+{
+    unsigned int firstLine;
+    unsigned int lastLine;
+    unsigned long long firstStep;
+    unsigned long long lastStep;
+};
+
+struct Program;
+struct Environment;
+
+//------------------------------------------------------------------------------
+// FUNCTION PROTOTYPES
+//------------------------------------------------------------------------------
+
+struct Program *loadBrainFuck(const char *const code, const size_t length);
+void freeProgram(struct Program *const program);
+
+void defaultOptions(struct Options *const options);
+struct Environment *newEnvironment(const struct Program *const program, const struct Options *const options, const struct Io *const io);
+int resetEnvironment(struct Environment *const env, const struct Io *const io);
+void freeEnvironment(struct Environment *const env);
+enum RunStatus runEnvironment(struct Environment *const env, const struct Budget *const budget);
+void interruptEnvironment(struct Environment *const env);
+void stopEnvironment(struct Environment *const env, const enum StopReason reason);
+enum StopReason environmentStop(const struct Environment *const env, unsigned int *const line, unsigned int *const col);
+const char *stopMessage(const enum StopReason reason);
+void printEnvironmentStop(const struct Environment *const env);
+void environmentUsage(const struct Environment *const env, struct Usage *const usage);
+const char *saveEnvironment(struct Environment *const env, const char *const fileName, const int incremental);
+const char *restoreEnvironment(struct Environment *const env, const char *const fileName);
+const char *environmentError(const struct Environment *const env, unsigned int *const line, unsigned int *const col);
+void printEnvironmentError(const struct Environment *const env);
+void printEnvironmentProfile(const struct Environment *const env);
+const char *traceEnvironment(struct Environment *const env, const char *const fileName, const struct TraceFilter *const filter);
+const char *printTrace(const struct Program *const program, const char *const fileName);
+
+//------------------------------------------------------------------------------
+// END
+//------------------------------------------------------------------------------
+#endif // __BRAINFUCK
@@ -0,0 +1,368 @@
+//------------------------------------------------------------------------------
+// LIBRARIES
+//------------------------------------------------------------------------------
+
+#define _DEFAULT_SOURCE // mkdir, getpid
+
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "cache.h"
+#include "hash.h"
+#include "prefix.h"
+
+//------------------------------------------------------------------------------
+// DEFINITIONS
+//------------------------------------------------------------------------------
+
+#define CACHE_MAGIC "BFCACHE1"
+// changes with the layout of the file and the meaning of the operations
+#define CACHE_VERSION 5
+
+//------------------------------------------------------------------------------
+// USER TYPES
+//------------------------------------------------------------------------------
+
+// A cache file is a compiled program in the byte order and the structure
+// layouts of the machine: a header, then the source code, the operations,
+// their offsets in the source, the starts of the lines, and the runs, the
+// cells and the output of the prefix, each one at a multiple of 8 bytes, so
+// the file is mapped and used in place. It is named after the hash of the
+// source code and the options, which the header holds as well. The hash can
+// be forced to collide, so the source code is compared too.
+struct CacheHeader
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t opSize;
+    uint32_t offsetSize;
+    uint32_t opNum;
+    uint64_t lineNum;
+    uint64_t sourceLength;
+    uint64_t sourceHash;
+    // options of the key
+    uint32_t debugCommands;
+    uint32_t cellBits;
+    uint32_t memorySize;
+    uint32_t tapeMode;
+    uint64_t stepBudget;
+    uint64_t outputBudget;
+    // the program has no prefix if prefixOpIdx is 0
+    uint32_t prefixOpIdx;
+    uint32_t prefixCellBits;
+    int64_t prefixMinCell;
+    int64_t prefixMaxCell;
+    int64_t prefixPointer;
+    uint64_t prefixRunNum;
+    uint64_t prefixCellNum;
+    uint64_t prefixSteps;
+    uint64_t prefixOutputSize;
+};
+
+// Offsets of the parts of a cache file
+struct CacheLayout
+{
+    uint64_t source;
+    uint64_t ops;
+    uint64_t offsets;
+    uint64_t lines;
+    uint64_t runs;
+    uint64_t cells;
+    uint64_t output;
+    uint64_t size;
+};
+
+//------------------------------------------------------------------------------
+// FUNCTIONS
+//------------------------------------------------------------------------------
+
+static uint64_t alignSize(const uint64_t size)
+{
+    return (size + 7) & ~(uint64_t)7;
+}
+
+static void keyHeader(struct CacheHeader *const header, const struct CacheOptions *const cache, const char *const source, const size_t length)
+{
+    memset(header, 0, sizeof(*header));
+    memcpy(header->magic, CACHE_MAGIC, sizeof(header->magic));
+    header->version = CACHE_VERSION;
+    header->opSize = sizeof(struct Op);
+    header->offsetSize = sizeof(size_t);
+    header->sourceLength = length;
+    header->sourceHash = hashBytes(HASH_BASIS, source, length);
+    header->debugCommands = cache->debugCommands != 0;
+    header->cellBits = cache->cellBits;
+    header->memorySize = cache->memorySize;
+    header->tapeMode = cache->tapeMode;
+    header->stepBudget = cache->prefixSteps;
+    header->outputBudget = cache->prefixOutputBytes;
+}
+
+// Same file, version, source code and options
+static int sameKey(const struct CacheHeader *const header, const struct CacheHeader *const key)
+{
+    return !memcmp(header->magic, key->magic, sizeof(key->magic)) && header->version == key->version &&
+           header->opSize == key->opSize && header->offsetSize == key->offsetSize &&
+           header->sourceLength == key->sourceLength && header->sourceHash == key->sourceHash &&
+           header->debugCommands == key->debugCommands && header->cellBits == key->cellBits &&
+           header->memorySize == key->memorySize && header->tapeMode == key->tapeMode &&
+           header->stepBudget == key->stepBudget && header->outputBudget == key->outputBudget;
+}
+
+static char *cacheFileName(const char *const directory, const struct CacheHeader *const key)
+{
+    const uint64_t options[] = {key->debugCommands, key->cellBits, key->memorySize, key->tapeMode, key->stepBudget, key->outputBudget};
+    const uint64_t hash = hashBytes(key->sourceHash, options, sizeof(options));
+    char *const fileName = (char *)malloc(strlen(directory) + sizeof("/0123456789abcdef.bfc"));
+    if (fileName)
+    {
+        sprintf(fileName, "%s/%016llx.bfc", directory, (unsigned long long)hash);
+    }
+    return fileName;
+}
+
+static struct CacheLayout cacheLayout(const struct CacheHeader *const header)
+{
+    struct CacheLayout layout;
+    layout.source = sizeof(struct CacheHeader);
+    layout.ops = alignSize(layout.source + header->sourceLength);
+    layout.offsets = alignSize(layout.ops + (uint64_t)header->opNum * sizeof(struct Op));
+    layout.lines = alignSize(layout.offsets + (uint64_t)header->opNum * sizeof(size_t));
+    layout.runs = alignSize(layout.lines + header->lineNum * sizeof(size_t));
+    layout.cells = alignSize(layout.runs + header->prefixRunNum * sizeof(struct PrefixRun));
+    layout.output = alignSize(layout.cells + header->prefixCellNum * (header->prefixCellBits / 8));
+    layout.size = alignSize(layout.output + header->prefixOutputSize);
+    return layout;
+}
+
+// The operations are checked like the compiler leaves them, so a damaged
+// file can't send the engines out of the program
+static int checkProgram(const struct CacheHeader *const header, const unsigned char *const data, const uint64_t fileSize)
+{
+    if (!header->opNum || (header->prefixOpIdx &&
+                           (header->prefixOpIdx >= header->opNum || header->prefixCellBits != header->cellBits ||
+                            header->prefixMinCell > 0 || header->prefixMaxCell < 0 ||
+                            header->prefixMaxCell - header->prefixMinCell >= (int64_t)1 << 32 ||
+                            header->prefixPointer < header->prefixMinCell || header->prefixPointer > header->prefixMaxCell ||
+                            header->prefixCellNum > (uint64_t)(header->prefixMaxCell - header->prefixMinCell + 1) ||
+                            header->prefixRunNum > header->prefixCellNum)) ||
+        (!header->prefixOpIdx && (header->prefixOutputSize || header->prefixRunNum || header->prefixCellNum)) ||
+        header->lineNum > header->sourceLength ||
+        cacheLayout(header).size != fileSize)
+    {
+        return EXIT_FAILURE;
+    }
+    const struct CacheLayout layout = cacheLayout(header);
+    const struct Op *const ops = (const struct Op *)(data + layout.ops);
+    const size_t *const offsets = (const size_t *)(data + layout.offsets);
+    const size_t *const lineStarts = (const size_t *)(data + layout.lines);
+    const struct PrefixRun *const runs = (const struct PrefixRun *)(data + layout.runs);
+    // the lines are searched in order
+    for (uint64_t lineIdx = 0; lineIdx < header->lineNum; lineIdx++)
+    {
+        if (lineStarts[lineIdx] > header->sourceLength || (lineIdx && lineStarts[lineIdx] <= lineStarts[lineIdx - 1]))
+        {
+            return EXIT_FAILURE;
+        }
+    }
+    // the runs are written in order, inside the cells reached, and hold the
+    // cells stored
+    uint64_t cellNum = 0;
+    for (uint64_t runIdx = 0; runIdx < header->prefixRunNum; runIdx++)
+    {
+        const struct PrefixRun *const run = &runs[runIdx];
+        if (!run->cellNum || run->cellNum > header->prefixCellNum - cellNum ||
+            run->firstCell < (runIdx ? runs[runIdx - 1].firstCell + (int64_t)runs[runIdx - 1].cellNum : header->prefixMinCell) ||
+            run->firstCell > header->prefixMaxCell || run->firstCell + (int64_t)run->cellNum - 1 > header->prefixMaxCell)
+        {
+            return EXIT_FAILURE;
+        }
+        cellNum += run->cellNum;
+    }
+    if (cellNum != header->prefixCellNum)
+    {
+        return EXIT_FAILURE;
+    }
+    for (unsigned int opIdx = 0; opIdx < header->opNum; opIdx++)
+    {
+        const struct Op *const op = &ops[opIdx];
+        if (op->code >= opNum || (op->code == opEnd) != (opIdx + 1 == header->opNum) || offsets[opIdx] > header->sourceLength)
+        {
+            return EXIT_FAILURE;
+        }
+        if ((op->code == opBeginLoop || op->code == opEndLoop) &&
+            ((unsigned int)op->arg >= header->opNum || ops[op->arg].code != (op->code == opBeginLoop ? opEndLoop : opBeginLoop) ||
+             ops[op->arg].arg != (int)opIdx))
+        {
+            return EXIT_FAILURE;
+        }
+        // a scan moves by its stride, and a range of cleared cells fits in
+        // the tape, whose unbounded kind takes two commands a cell
+        const long long distance = op->arg < 0 ? -(long long)op->arg : op->arg;
+        if ((op->code == opScan && !op->arg) ||
+            (op->code == opClearRange &&
+             (!distance || distance >= (header->tapeMode == tapeUnbounded ? (long long)header->sourceLength : (long long)header->memorySize))))
+        {
+            return EXIT_FAILURE;
+        }
+    }
+    return EXIT_SUCCESS;
+}
+
+static struct Program *cachedProgram(const struct CacheHeader *const header, unsigned char *const data, const uint64_t fileSize, const char *const source)
+{
+    struct Program *const program = newProgram(source, header->sourceLength, header->debugCommands);
+    struct Prefix *const prefix = header->prefixOpIdx ? (struct Prefix *)malloc(sizeof(struct Prefix)) : NULL;
+    if (!program || (header->prefixOpIdx && !prefix))
+    {
+        freeProgram(program);
+        free((void *)prefix);
+        return NULL;
+    }
+    const struct CacheLayout layout = cacheLayout(header);
+    program->ops = (struct Op *)(data + layout.ops);
+    program->offsets = (size_t *)(data + layout.offsets);
+    program->opNum = header->opNum;
+    program->opCapacity = header->opNum;
+    program->lineStarts = (size_t *)(data + layout.lines);
+    program->lineNum = (unsigned int)header->lineNum;
+    program->lineCapacity = (unsigned int)header->lineNum;
+    program->cache = data;
+    program->cacheSize = fileSize;
+    if (prefix)
+    {
+        *prefix = (struct Prefix){
+            .cellBits = header->prefixCellBits,
+            .opIdx = header->prefixOpIdx,
+            .minCell = header->prefixMinCell,
+            .maxCell = header->prefixMaxCell,
+            .pointer = header->prefixPointer,
+            .runs = (struct PrefixRun *)(data + layout.runs),
+            .runNum = header->prefixRunNum,
+            .cells = data + layout.cells,
+            .steps = header->prefixSteps,
+            .output = data + layout.output,
+            .outputSize = header->prefixOutputSize,
+        };
+        program->prefix = prefix;
+    }
+    return program;
+}
+
+// Returns the program compiled from this source code with these options, or
+// NULL if the cache doesn't have it. The operations stay in the mapping of
+// the file, which the program owns.
+struct Program *readCache(const struct CacheOptions *const cache, const char *const source, const size_t length)
+{
+    struct CacheHeader key;
+    keyHeader(&key, cache, source, length);
+    char *const fileName = cacheFileName(cache->directory, &key);
+    const int fd = fileName ? open(fileName, O_RDONLY) : -1;
+    free((void *)fileName);
+    if (fd < 0)
+    {
+        return NULL;
+    }
+    struct stat status;
+    void *address = MAP_FAILED;
+    if (!fstat(fd, &status) && (uint64_t)status.st_size >= sizeof(struct CacheHeader))
+    {
+        address = mmap(NULL, status.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    close(fd);
+    if (address == MAP_FAILED)
+    {
+        return NULL;
+    }
+    unsigned char *const data = (unsigned char *)address;
+    const struct CacheHeader *const header = (const struct CacheHeader *)data;
+    struct Program *program = NULL;
+    if (sameKey(header, &key) && !checkProgram(header, data, status.st_size) &&
+        !memcmp(data + cacheLayout(header).source, source, length))
+    {
+        program = cachedProgram(header, data, status.st_size, source);
+    }
+    if (!program)
+    {
+        munmap(address, status.st_size);
+    }
+    return program;
+}
+
+static int writePadded(FILE *const file, const void *const data, const uint64_t size)
+{
+    static const unsigned char padding[8] = {0};
+    return (size && fwrite(data, size, 1, file) != 1) ||
+           (alignSize(size) != size && fwrite(padding, alignSize(size) - size, 1, file) != 1);
+}
+
+// Stores a program compiled from a mapped source, with its prefix. The file
+// is written under a temporary name and renamed, so the other processes
+// either see it whole or don't see it.
+int writeCache(const struct CacheOptions *const cache, const struct Program *const program)
+{
+    if (!program->source || program->cache)
+    {
+        return EXIT_FAILURE;
+    }
+    struct CacheHeader header;
+    keyHeader(&header, cache, program->source, program->sourceLength);
+    header.opNum = program->opNum;
+    header.lineNum = program->lineNum;
+    const struct Prefix *const prefix = program->prefix;
+    if (prefix)
+    {
+        header.prefixOpIdx = prefix->opIdx;
+        header.prefixCellBits = prefix->cellBits;
+        header.prefixMinCell = prefix->minCell;
+        header.prefixMaxCell = prefix->maxCell;
+        header.prefixPointer = prefix->pointer;
+        header.prefixRunNum = prefix->runNum;
+        for (size_t runIdx = 0; runIdx < prefix->runNum; runIdx++)
+        {
+            header.prefixCellNum += prefix->runs[runIdx].cellNum;
+        }
+        header.prefixSteps = prefix->steps;
+        header.prefixOutputSize = prefix->outputSize;
+    }
+    mkdir(cache->directory, 0777);
+    char *const fileName = cacheFileName(cache->directory, &header);
+    char *const tempName = fileName ? (char *)malloc(strlen(fileName) + sizeof(".tmp.4294967295")) : NULL;
+    if (!tempName)
+    {
+        free((void *)fileName);
+        return EXIT_FAILURE;
+    }
+    sprintf(tempName, "%s.tmp.%u", fileName, (unsigned int)getpid());
+    FILE *const file = fopen(tempName, "wb");
+    int result = EXIT_FAILURE;
+    if (file)
+    {
+        result = fwrite(&header, sizeof(header), 1, file) != 1 ||
+                 writePadded(file, program->source, program->sourceLength) ||
+                 writePadded(file, program->ops, (uint64_t)program->opNum * sizeof(struct Op)) ||
+                 writePadded(file, program->offsets, (uint64_t)program->opNum * sizeof(size_t)) ||
+                 writePadded(file, program->lineStarts, (uint64_t)program->lineNum * sizeof(size_t)) ||
+                 writePadded(file, prefix ? prefix->runs : NULL, header.prefixRunNum * sizeof(struct PrefixRun)) ||
+                 writePadded(file, prefix ? prefix->cells : NULL, header.prefixCellNum * header.prefixCellBits / 8) ||
+                 writePadded(file, prefix ? prefix->output : NULL, prefix ? prefix->outputSize : 0);
+        result = fclose(file) || result;
+        if (result || rename(tempName, fileName))
+        {
+            remove(tempName);
+            result = EXIT_FAILURE;
+        }
+    }
+    free((void *)tempName);
+    free((void *)fileName);
+    return result;
+}
+
+//------------------------------------------------------------------------------
+// END
+//------------------------------------------------------------------------------
@@ -0,0 +1,38 @@
+#ifndef __CACHE
+#define __CACHE
+
+//------------------------------------------------------------------------------
+// LIBRARIES
+//------------------------------------------------------------------------------
+
+#include "brainfuck.h"
+#include "program.h"
+
+//------------------------------------------------------------------------------
+// USER TYPES
+//------------------------------------------------------------------------------
+
+// Directory of the cache, and the options that change the compiled program
+// and its prefix, which are part of the key with the source code
+struct CacheOptions
+{
+    const char *directory;
+    int debugCommands;
+    unsigned int cellBits;
+    unsigned int memorySize;
+    enum TapeMode tapeMode;
+    unsigned long long prefixSteps;
+    unsigned long long prefixOutputBytes;
+};
+
+//------------------------------------------------------------------------------
+// FUNCTION PROTOTYPES
+//------------------------------------------------------------------------------
+
+struct Program *readCache(const struct CacheOptions *const cache, const char *const source, const size_t length);
+int writeCache(const struct CacheOptions *const cache, const struct Program *const program);
+
+//------------------------------------------------------------------------------
+// END
+//------------------------------------------------------------------------------
+#endif // __CACHE
@@ -0,0 +1,433 @@
+//------------------------------------------------------------------------------
+// LIBRARIES
+//------------------------------------------------------------------------------
+
+#define _DEFAULT_SOURCE // MADV_SEQUENTIAL
+
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "checker.h"
+
+// The source is classified 16 bytes at a time by SSE2, which every x86-64
+// processor has, with bit scans and population counts of GNU compilers
+#if defined(__SSE2__) && defined(__GNUC__)
+#define SIMD_SCAN 1
+#include <emmintrin.h>
+#else
+#define SIMD_SCAN 0
+#endif
+
+//------------------------------------------------------------------------------
+// DEFINITIONS
+//------------------------------------------------------------------------------
+
+#define CHUNK_SIZE (1024 * 1024)
+#define SIMD_WIDTH 16
+// Bounds of the pointer that can't be proven
+#define NO_LOW_BOUND LLONG_MIN
+#define NO_HIGH_BOUND LLONG_MAX
+
+//------------------------------------------------------------------------------
+// USER TYPES
+//------------------------------------------------------------------------------
+
+enum Command
+{
+    cmdIncrement = 0,
+    cmdDecrement,
+    cmdRight,
+    cmdLeft,
+    cmdOutput,
+    cmdInput,
+    cmdBeginLoop,
+    cmdEndLoop,
+    cmdPrintCell,
+    cmdPrintAllCells,
+    cmdNum,
+};
+
+// Moves of the pointer in the program, or in an iteration of a loop, from
+// where it starts: the range of positions where it may end, and of the cells
+// it may reach
+struct Reach
+{
+    long long shiftLow;
+    long long shiftHigh;
+    long long low;
+    long long high;
+    // of the [ of the loop
+    unsigned long long line;
+    unsigned long long col;
+};
+
+struct Checker
+{
+    unsigned long long counts[cmdNum];
+    unsigned long long bytes;
+    // location of the last byte, as in the error messages
+    unsigned long long line;
+    unsigned long long col;
+    // the program, then the open loops, from the outermost one
+    struct Reach *loops;
+    size_t depth;
+    size_t capacity;
+    size_t maxDepth;
+    unsigned long long errors;
+    int outOfMemory;
+};
+
+//------------------------------------------------------------------------------
+// GLOBAL VARIABLES
+//------------------------------------------------------------------------------
+
+static const char commandChars[cmdNum + 1] = "+-><.,[]#@";
+
+//------------------------------------------------------------------------------
+// FUNCTIONS
+//------------------------------------------------------------------------------
+
+static long long addBounds(const long long first, const long long second)
+{
+    if (first == NO_LOW_BOUND || second == NO_LOW_BOUND)
+    {
+        return NO_LOW_BOUND;
+    }
+    if (first == NO_HIGH_BOUND || second == NO_HIGH_BOUND)
+    {
+        return NO_HIGH_BOUND;
+    }
+    return first + second;
+}
+
+static void move(struct Checker *const checker, const long long cells)
+{
+    struct Reach *const reach = &checker->loops[checker->depth];
+    reach->shiftLow = addBounds(reach->shiftLow, cells);
+    reach->shiftHigh = addBounds(reach->shiftHigh, cells);
+    reach->low = reach->shiftLow < reach->low ? reach->shiftLow : reach->low;
+    reach->high = reach->shiftHigh > reach->high ? reach->shiftHigh : reach->high;
+}
+
+static void beginLoop(struct Checker *const checker, const unsigned long long line, const unsigned long long col)
+{
+    if (checker->depth + 1 == checker->capacity)
+    {
+        const size_t capacity = 2 * checker->capacity;
+        struct Reach *const loops = (struct Reach *)realloc((void *)checker->loops, capacity * sizeof(struct Reach));
+        if (!loops)
+        {
+            checker->outOfMemory = 1;
+            return;
+        }
+        checker->loops = loops;
+        checker->capacity = capacity;
+    }
+    checker->depth++;
+    checker->loops[checker->depth] = (struct Reach){.shiftLow = 0, .shiftHigh = 0, .low = 0, .high = 0, .line = line, .col = col};
+    checker->maxDepth = checker->depth > checker->maxDepth ? checker->depth : checker->maxDepth;
+}
+
+// A loop runs its body any number of times, zero included: unless the body
+// is balanced, the pointer may end anywhere in the direction of its moves
+static void closeLoop(struct Checker *const checker)
+{
+    const struct Reach *const body = &checker->loops[checker->depth--];
+    struct Reach *const outer = &checker->loops[checker->depth];
+    const long long shiftLow = body->shiftLow < 0 ? NO_LOW_BOUND : 0;
+    const long long shiftHigh = body->shiftHigh > 0 ? NO_HIGH_BOUND : 0;
+    // every iteration starts in the range of the shifts, and reaches the
+    // cells of the body around its start
+    const long long low = addBounds(outer->shiftLow, addBounds(shiftLow, body->low));
+    const long long high = addBounds(outer->shiftHigh, addBounds(shiftHigh, body->high));
+    outer->low = low < outer->low ? low : outer->low;
+    outer->high = high > outer->high ? high : outer->high;
+    outer->shiftLow = addBounds(outer->shiftLow, shiftLow);
+    outer->shiftHigh = addBounds(outer->shiftHigh, shiftHigh);
+}
+
+static void endLoop(struct Checker *const checker, const unsigned long long line, const unsigned long long col)
+{
+    if (!checker->depth)
+    {
+        fprintf(stderr, "\n[Error in line %llu, column %llu]: Incorrect loop declaration\n", line, col);
+        checker->errors++;
+        return;
+    }
+    closeLoop(checker);
+}
+
+static void checkCommand(struct Checker *const checker, const unsigned char byte, const unsigned long long line, const unsigned long long col)
+{
+    switch (byte)
+    {
+    case '+':
+        checker->counts[cmdIncrement]++;
+        break;
+    case '-':
+        checker->counts[cmdDecrement]++;
+        break;
+    case '>':
+        checker->counts[cmdRight]++;
+        move(checker, 1);
+        break;
+    case '<':
+        checker->counts[cmdLeft]++;
+        move(checker, -1);
+        break;
+    case '.':
+        checker->counts[cmdOutput]++;
+        break;
+    case ',':
+        checker->counts[cmdInput]++;
+        break;
+    case '[':
+        checker->counts[cmdBeginLoop]++;
+        beginLoop(checker, line, col);
+        break;
+    case ']':
+        checker->counts[cmdEndLoop]++;
+        endLoop(checker, line, col);
+        break;
+    case '#':
+        checker->counts[cmdPrintCell]++;
+        break;
+    case '@':
+        checker->counts[cmdPrintAllCells]++;
+        break;
+    default:
+        break;
+    }
+}
+
+static void checkByte(struct Checker *const checker, const unsigned char byte)
+{
+    if (byte == '\n')
+    {
+        checker->line++;
+        checker->col = 0;
+        return;
+    }
+    checker->col++;
+    checkCommand(checker, byte, checker->line, checker->col);
+}
+
+#if SIMD_SCAN
+static unsigned int byteMask(const __m128i bytes, const char value)
+{
+    return (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_set1_epi8(value)));
+}
+
+// The blocks of comments only update the location, the commands that don't
+// move the pointer are counted at once, and only the moves and brackets are
+// visited one by one
+static size_t checkBlocks(struct Checker *const checker, const unsigned char *const data, const size_t length)
+{
+    size_t index = 0;
+    for (; index + SIMD_WIDTH <= length && !checker->outOfMemory; index += SIMD_WIDTH)
+    {
+        const __m128i bytes = _mm_loadu_si128((const __m128i *)&data[index]);
+        const unsigned int newlines = byteMask(bytes, '\n');
+        const unsigned int moves = byteMask(bytes, '>') | byteMask(bytes, '<') | byteMask(bytes, '[') | byteMask(bytes, ']');
+        const unsigned int increments = byteMask(bytes, '+');
+        const unsigned int decrements = byteMask(bytes, '-');
+        const unsigned int outputs = byteMask(bytes, '.');
+        const unsigned int inputs = byteMask(bytes, ',');
+        const unsigned int printCells = byteMask(bytes, '#');
+        const unsigned int printAllCells = byteMask(bytes, '@');
+        if (increments | decrements | outputs | inputs | printCells | printAllCells)
+        {
+            checker->counts[cmdIncrement] += __builtin_popcount(increments);
+            checker->counts[cmdDecrement] += __builtin_popcount(decrements);
+            checker->counts[cmdOutput] += __builtin_popcount(outputs);
+            checker->counts[cmdInput] += __builtin_popcount(inputs);
+            checker->counts[cmdPrintCell] += __builtin_popcount(printCells);
+            checker->counts[cmdPrintAllCells] += __builtin_popcount(printAllCells);
+        }
+        for (unsigned int remaining = moves; remaining; remaining &= remaining - 1)
+        {
+            const unsigned int position = __builtin_ctz(remaining);
+            // the newlines before the command in the block give its location
+            const unsigned int before = newlines & ((1u << position) - 1);
+            const unsigned long long line = checker->line + __builtin_popcount(before);
+            const unsigned long long col = before ? position - (31 - __builtin_clz(before)) : checker->col + position + 1;
+            checkCommand(checker, data[index + position], line, col);
+        }
+        if (newlines)
+        {
+            checker->line += __builtin_popcount(newlines);
+            checker->col = SIMD_WIDTH - 1 - (31 - __builtin_clz(newlines));
+        }
+        else
+        {
+            checker->col += SIMD_WIDTH;
+        }
+    }
+    return index;
+}
+#endif
+
+static void checkChunk(struct Checker *const checker, const unsigned char *const data, const size_t length)
+{
+    size_t index = 0;
+#if SIMD_SCAN
+    index = checkBlocks(checker, data, length);
+#endif
+    for (; index < length; index++)
+    {
+        checkByte(checker, data[index]);
+    }
+    checker->bytes += length;
+}
+
+// Regular files are mapped, like for the compilation, and streams are read
+// one chunk at a time
+static int scanFile(struct Checker *const checker, const int fd)
+{
+    struct stat st;
+    if (fstat(fd, &st))
+    {
+        return EXIT_FAILURE;
+    }
+    if (S_ISREG(st.st_mode))
+    {
+        if (!st.st_size)
+        {
+            return EXIT_SUCCESS;
+        }
+        void *const source = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (source == MAP_FAILED)
+        {
+            return EXIT_FAILURE;
+        }
+        madvise(source, st.st_size, MADV_SEQUENTIAL);
+        checkChunk(checker, (const unsigned char *)source, st.st_size);
+        munmap(source, st.st_size);
+        return EXIT_SUCCESS;
+    }
+    unsigned char *const chunk = (unsigned char *)malloc(CHUNK_SIZE);
+    if (!chunk)
+    {
+        return EXIT_FAILURE;
+    }
+    for (;;)
+    {
+        const ssize_t length = read(fd, chunk, CHUNK_SIZE);
+        if (length < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (length <= 0)
+        {
+            free((void *)chunk);
+            return length ? EXIT_FAILURE : EXIT_SUCCESS;
+        }
+        checkChunk(checker, chunk, length);
+    }
+}
+
+static const char *boundText(const long long bound, char *const text, const size_t size)
+{
+    if (bound == NO_LOW_BOUND || bound == NO_HIGH_BOUND)
+    {
+        return "unbounded";
+    }
+    snprintf(text, size, "%lld", bound);
+    return text;
+}
+
+static void printReport(const struct Checker *const checker, const char *const fileName, const struct Options *const options)
+{
+    unsigned long long total = 0;
+    for (unsigned int cmdIdx = 0; cmdIdx < cmdNum; cmdIdx++)
+    {
+        total += checker->counts[cmdIdx];
+    }
+    const unsigned long long lines = (checker->bytes && checker->col) ? checker->line : checker->line - 1;
+    printf("[Check]: %s: %llu bytes, %llu lines, %llu instructions\n", fileName, checker->bytes, lines, total);
+    printf("[Instructions]:");
+    for (unsigned int cmdIdx = 0; cmdIdx < cmdNum; cmdIdx++)
+    {
+        printf("%s %c %llu", cmdIdx ? "," : "", commandChars[cmdIdx], checker->counts[cmdIdx]);
+    }
+    printf("\n[Loops]: %llu, nested at most %zu deep\n", checker->counts[cmdBeginLoop], checker->maxDepth);
+    const struct Reach *const program = &checker->loops[0];
+    char low[32], high[32];
+    printf("[Pointer]: cells %s to %s from the first one", boundText(program->low, low, sizeof(low)), boundText(program->high, high, sizeof(high)));
+    if (options->tapeMode == tapeUnbounded)
+    {
+        printf(", on an unbounded tape\n");
+    }
+    else if (program->low >= 0 && program->high < (long long)options->memorySize)
+    {
+        printf(", always in the tape of %u cells\n", options->memorySize);
+    }
+    else
+    {
+        printf(", may leave the tape of %u cells\n", options->memorySize);
+    }
+}
+
+// Validates the source without compiling nor running it, in one pass that
+// only keeps the open loops: reports every unmatched bracket, the counts of
+// the instructions, the nesting of the loops and the cells the pointer may
+// reach, which are exact when the loops move it back where they started
+int checkFile(const char *const fileName, const struct Options *const options)
+{
+    struct Checker checker = {
+        .bytes = 0,
+        .line = 1,
+        .col = 0,
+        .loops = (struct Reach *)malloc(16 * sizeof(struct Reach)),
+        .depth = 0,
+        .capacity = 16,
+        .maxDepth = 0,
+        .errors = 0,
+        .outOfMemory = 0,
+    };
+    memset(checker.counts, 0, sizeof(checker.counts));
+    if (!checker.loops)
+    {
+        fprintf(stderr, "\n[Error]: Couldn't check the file %s: out of memory\n", fileName);
+        return EXIT_FAILURE;
+    }
+    checker.loops[0] = (struct Reach){.shiftLow = 0, .shiftHigh = 0, .low = 0, .high = 0, .line = 0, .col = 0};
+    const int useStdin = !strcmp(fileName, "-");
+    const int fd = useStdin ? STDIN_FILENO : open(fileName, O_RDONLY);
+    const int failed = fd < 0 || scanFile(&checker, fd);
+    const int error = errno;
+    if (fd >= 0 && !useStdin)
+    {
+        close(fd);
+    }
+    if (failed || checker.outOfMemory)
+    {
+        fprintf(stderr, "\n[Error]: Couldn't check the file %s: %s\n", fileName, checker.outOfMemory ? "out of memory" : strerror(error));
+        free((void *)checker.loops);
+        return EXIT_FAILURE;
+    }
+    // the loops left open are reported in order, and closed at the end
+    for (size_t loopIdx = 1; loopIdx <= checker.depth; loopIdx++)
+    {
+        fprintf(stderr, "\n[Error in line %llu, column %llu]: Missing end of the loop ']'\n", checker.loops[loopIdx].line, checker.loops[loopIdx].col);
+        checker.errors++;
+    }
+    while (checker.depth)
+    {
+        closeLoop(&checker);
+    }
+    fflush(stderr);
+    printReport(&checker, fileName, options);
+    free((void *)checker.loops);
+    return checker.errors ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// END
+//------------------------------------------------------------------------------
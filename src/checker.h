@@ -0,0 +1,19 @@
+#ifndef __CHECKER
+#define __CHECKER
+
+//------------------------------------------------------------------------------
+// LIBRARIES
+//------------------------------------------------------------------------------
+
+#include "brainfuck.h"
+
+//------------------------------------------------------------------------------
+// FUNCTION PROTOTYPES
+//------------------------------------------------------------------------------
+
+int checkFile(const char *const fileName, const struct Options *const options);
+
+//------------------------------------------------------------------------------
+// END
+//------------------------------------------------------------------------------
+#endif // __CHECKER
@@ -0,0 +1,260 @@
+//------------------------------------------------------------------------------
+// LIBRARIES
+//------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "emitter.h"
+#include "parser.h"
+
+//------------------------------------------------------------------------------
+// USER TYPES
+//------------------------------------------------------------------------------
+
+struct Emitter
+{
+    FILE *file;
+    const struct Program *program;
+    const struct Options *options;
+    // the translation prompts for keys
+    int interactive;
+    unsigned int depth;
+    // only the @ command uses the highest cell reached
+    int trackMax;
+};
+
+//------------------------------------------------------------------------------
+// FUNCTIONS
+//------------------------------------------------------------------------------
+
+static void indent(FILE *const file, const unsigned int depth)
+{
+    for (unsigned int level = 0; level < depth; level++)
+    {
+        fprintf(file, "    ");
+    }
+}
+
+// Emits a check of a tape index against the tape limit in the direction it moved
+static void emitBoundsCheck(const struct Emitter *const emitter, const unsigned int depth, const char *const index, const int forward, const struct Location *const location)
+{
+    FILE *const file = emitter->file;
+    indent(file, depth);
+    if (forward)
+    {
+        fprintf(file, "if (%s >= MEMORY_SIZE)\n", index);
+    }
+    else
+    {
+        fprintf(file, "if (%s < 0)\n", index);
+    }
+    indent(file, depth + 1);
+    fprintf(file, "pointerError(%u, %u);\n", location->line, location->col);
+    if (emitter->trackMax)
+    {
+        indent(file, depth);
+        fprintf(file, "maxIndex = %s > maxIndex ? %s : maxIndex;\n", index, index);
+    }
+}
+
+static int usesOp(const struct Program *const program, const enum OpCode code)
+{
+    for (unsigned int opIdx = 0; opIdx < program->opNum; opIdx++)
+    {
+        if (program->ops[opIdx].code == code)
+        {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static void emitPrologue(const struct Emitter *const emitter, const char *const sourceName)
+{
+    FILE *const file = emitter->file;
+    const struct Program *const program = emitter->program;
+    const enum EofMode eofMode = emitter->options->eofMode;
+    fprintf(file, "// Generated by BrainFuckInterpreter from %s\n", sourceName);
+    fprintf(file, "#include <stdint.h>\n");
+    fprintf(file, "#include <stdio.h>\n");
+    fprintf(file, "#include <stdlib.h>\n");
+    if (usesOp(program, opClearRange))
+    {
+        fprintf(file, "#include <string.h>\n");
+    }
+    fprintf(file, "\n");
+    fprintf(file, "#define MEMORY_SIZE %u\n\n", emitter->options->memorySize);
+    fprintf(file, "static uint%u_t mem[MEMORY_SIZE];\n\n", emitter->options->cellBits);
+    if (usesOp(program, opMove) || usesOp(program, opMultiply) || usesOp(program, opScan) || usesOp(program, opClearRange))
+    {
+        fprintf(file, "static void pointerError(const unsigned int line, const unsigned int col)\n");
+        fprintf(file, "{\n");
+        fprintf(file, "    fprintf(stderr, \"\\n[Error in line %%u, column %%u]: Invalid pointer address\\n\", line, col);\n");
+        fprintf(file, "    exit(EXIT_FAILURE);\n");
+        fprintf(file, "}\n\n");
+    }
+    if (usesOp(program, opGetByte))
+    {
+        // the translation prompts for keys only if explicitly asked to
+        fprintf(file, "static int getByte(const int value)\n");
+        fprintf(file, "{\n");
+        if (emitter->interactive)
+        {
+            fprintf(file, "    printf(\"\\nInsert a key:\\n\");\n");
+            fprintf(file, "    const int key = getchar();\n");
+            fprintf(file, "    putchar('\\n');\n");
+        }
+        else
+        {
+            fprintf(file, "    const int key = getchar();\n");
+        }
+        if (eofMode != eofUnchanged)
+        {
+            fprintf(file, "    (void)value;\n");
+        }
+        fprintf(file, "    if (key == EOF)\n");
+        fprintf(file, "    {\n");
+        fprintf(file, "        return %s;\n", eofMode == eofZero ? "0" : (eofMode == eofUnchanged ? "value" : "EOF"));
+        fprintf(file, "    }\n");
+        fprintf(file, "    return key;\n");
+        fprintf(file, "}\n\n");
+    }
+    fprintf(file, "int main(void)\n");
+    fprintf(file, "{\n");
+    fprintf(file, "    long index = 0;\n");
+    if (emitter->trackMax)
+    {
+        fprintf(file, "    long maxIndex = 0;\n");
+    }
+}
+
+static void emitOp(struct Emitter *const emitter, const unsigned int opIdx)
+{
+    FILE *const file = emitter->file;
+    unsigned int *const depth = &emitter->depth;
+    const struct Op *const op = &emitter->program->ops[opIdx];
+    const struct Location location = opLocation(emitter->program, opIdx);
+    switch (op->code)
+    {
+    case opMove:
+        indent(file, *depth);
+        fprintf(file, "index += %d;\n", op->arg);
+        emitBoundsCheck(emitter, *depth, "index", op->arg > 0, &location);
+        break;
+    case opAdd:
+        indent(file, *depth);
+        fprintf(file, "mem[index] += %d;\n", op->arg);
+        break;
+    case opClear:
+        indent(file, *depth);
+        fprintf(file, "mem[index] = 0;\n");
+        break;
+    case opMultiply:
+        indent(file, *depth);
+        fprintf(file, "if (mem[index])\n");
+        indent(file, *depth);
+        fprintf(file, "{\n");
+        indent(file, *depth + 1);
+        fprintf(file, "const long destination = index + %d;\n", op->offset);
+        emitBoundsCheck(emitter, *depth + 1, "destination", op->offset > 0, &location);
+        indent(file, *depth + 1);
+        // unsigned, so the product wraps around instead of overflowing an int
+        fprintf(file, "mem[destination] += (unsigned int)mem[index] * %uu;\n", (unsigned int)op->arg);
+        indent(file, *depth);
+        fprintf(file, "}\n");
+        break;
+    case opScan:
+        indent(file, *depth);
+        fprintf(file, "while (mem[index])\n");
+        indent(file, *depth);
+        fprintf(file, "{\n");
+        indent(file, *depth + 1);
+        fprintf(file, "index += %d;\n", op->arg);
+        emitBoundsCheck(emitter, *depth + 1, "index", op->arg > 0, &location);
+        indent(file, *depth);
+        fprintf(file, "}\n");
+        break;
+    case opClearRange:
+        indent(file, *depth);
+        fprintf(file, "index += %d;\n", op->arg);
+        emitBoundsCheck(emitter, *depth, "index", op->arg > 0, &location);
+        // the range is cleared from its lowest cell
+        indent(file, *depth);
+        if (op->arg > 0)
+        {
+            fprintf(file, "memset(&mem[index - %d], 0, %d * sizeof(mem[0]));\n", op->arg, op->arg + 1);
+        }
+        else
+        {
+            fprintf(file, "memset(&mem[index], 0, %d * sizeof(mem[0]));\n", 1 - op->arg);
+        }
+        break;
+    case opBeginLoop:
+        indent(file, *depth);
+        fprintf(file, "while (mem[index])\n");
+        indent(file, *depth);
+        fprintf(file, "{\n");
+        (*depth)++;
+        break;
+    case opEndLoop:
+        (*depth)--;
+        indent(file, *depth);
+        fprintf(file, "}\n");
+        break;
+    case opOutputByte:
+        indent(file, *depth);
+        fprintf(file, "putchar(mem[index]);\n");
+        break;
+    case opGetByte:
+        indent(file, *depth);
+        fprintf(file, "mem[index] = getByte(mem[index]);\n");
+        break;
+    case opPrintCell:
+        if (emitter->options->debugMode)
+        {
+            indent(file, *depth);
+            fprintf(file, "printf(\"\\ncell %%ld: %%u\\n\", index, (unsigned int)mem[index]);\n");
+        }
+        break;
+    case opPrintAllCells:
+        if (emitter->trackMax)
+        {
+            indent(file, *depth);
+            fprintf(file, "printf(\"\\n\");\n");
+            indent(file, *depth);
+            fprintf(file, "for (long cell = 0; cell <= maxIndex; cell++)\n");
+            indent(file, *depth + 1);
+            fprintf(file, "printf(\"cell %%ld: %%u\\n\", cell, (unsigned int)mem[cell]);\n");
+        }
+        break;
+    case opEnd:
+        indent(file, *depth);
+        fprintf(file, "return EXIT_SUCCESS;\n");
+        fprintf(file, "}\n");
+        break;
+    }
+}
+
+// Writes a standalone C translation of the program, so it can be compiled
+// to a native binary by the system compiler
+int emitC(const struct Program *const program, FILE *const file, const char *const sourceName, const struct Options *const options, const int interactive)
+{
+    struct Emitter emitter = {
+        .file = file,
+        .program = program,
+        .options = options,
+        .interactive = interactive,
+        .depth = 1,
+        .trackMax = options->debugMode && usesOp(program, opPrintAllCells),
+    };
+    emitPrologue(&emitter, sourceName);
+    for (unsigned int opIdx = 0; opIdx < program->opNum; opIdx++)
+    {
+        emitOp(&emitter, opIdx);
+    }
+    return ferror(file) ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// END
+//------------------------------------------------------------------------------
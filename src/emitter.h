@@ -0,0 +1,21 @@
+#ifndef __EMITTER
+#define __EMITTER
+
+//------------------------------------------------------------------------------
+// LIBRARIES
+//------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include "brainfuck.h"
+#include "program.h"
+
+//------------------------------------------------------------------------------
+// FUNCTION PROTOTYPES
+//------------------------------------------------------------------------------
+
+int emitC(const struct Program *const program, FILE *const file, const char *const sourceName, const struct Options *const options, const int interactive);
+
+//------------------------------------------------------------------------------
+// END
+//------------------------------------------------------------------------------
+#endif // __EMITTER
@@ -0,0 +1,354 @@
+//------------------------------------------------------------------------------
+// LIBRARIES
+//------------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "engine.h"
+#include "tape.h"
+#include "profile.h"
+#include "trace.h"
+#include "prefix.h"
+#include "io.h"
+
+//------------------------------------------------------------------------------
+// DEFINITIONS
+//------------------------------------------------------------------------------
+
+// Labels as values are a GNU extension, supported by gcc and clang
+#if defined(__GNUC__)
+#define THREADED_DISPATCH 1
+#else
+#define THREADED_DISPATCH 0
+#endif
+
+//------------------------------------------------------------------------------
+// FUNCTIONS
+//------------------------------------------------------------------------------
+
+static unsigned long long currentMilliseconds(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (unsigned long long)now.tv_sec * 1000 + now.tv_nsec / 1000000;
+}
+
+// Starts the next countdown of loop iterations, which are counted in advance
+static void reloadCountdown(struct Environment *const env)
+{
+    unsigned long long interval = BUDGET_CHECK_STEPS;
+    if (env->stepLimit && env->stepLimit - env->steps < interval)
+    {
+        interval = env->stepLimit - env->steps;
+    }
+    env->countdown = interval;
+    env->steps += interval;
+}
+
+// Called by the engines when the countdown runs out: returns if the run must
+// stop, and why in stopReason
+int checkBudget(struct Environment *const env)
+{
+    enum StopReason reason = (enum StopReason)env->stopRequest;
+    if (reason == stopNone)
+    {
+        if (env->output.truncated)
+        {
+            reason = stopOutput;
+        }
+        else if (env->stepLimit && env->steps >= env->stepLimit)
+        {
+            reason = stopSteps;
+        }
+        else if (env->deadline && currentMilliseconds() >= env->deadline)
+        {
+            reason = stopTime;
+        }
+    }
+    if (reason != stopNone)
+    {
+        env->stopRequest = stopNone;
+        env->stopReason = reason;
+        return 1;
+    }
+    reloadCountdown(env);
+    return 0;
+}
+
+void startBudget(struct Environment *const env, const struct Budget *const budget)
+{
+    // the iterations counted in advance by the last countdown were not run
+    env->steps -= env->countdown;
+    env->stepLimit = (budget && budget->steps) ? env->steps + budget->steps : 0;
+    env->deadline = (budget && budget->milliseconds) ? currentMilliseconds() + budget->milliseconds : 0;
+    limitOutput(&env->output, budget ? budget->outputBytes : 0);
+    if (env->prefix)
+    {
+        // the first run counts the iterations and writes the output of the
+        // prefix, which ran at load time
+        env->steps += env->prefix->steps;
+        // the output of a prefix that wrote nothing is NULL
+        if (env->prefix->outputSize)
+        {
+            writeBlock(&env->output, env->prefix->output, env->prefix->outputSize);
+        }
+        env->prefix = NULL;
+    }
+    reloadCountdown(env);
+}
+
+// The engines are instantiated for each cell width and tape mode, and
+// selected through a table indexed by cellBits / 16 (8 -> 0, 16 -> 1, 32 -> 2)
+
+// Portable engine, dispatches each operation through a switch
+#define ENGINE_NAME runSwitch8
+#define CELL uint8_t
+#define CELL_BITS 8
+#include "engineTemplate.h"
+#define ENGINE_NAME runSwitch16
+#define CELL uint16_t
+#define CELL_BITS 16
+#include "engineTemplate.h"
+#define ENGINE_NAME runSwitch32
+#define CELL uint32_t
+#define CELL_BITS 32
+#include "engineTemplate.h"
+#define ENGINE_NAME runSwitch8Unbounded
+#define ENGINE_UNBOUNDED
+#define CELL uint8_t
+#define CELL_BITS 8
+#include "engineTemplate.h"
+#define ENGINE_NAME runSwitch16Unbounded
+#define ENGINE_UNBOUNDED
+#define CELL uint16_t
+#define CELL_BITS 16
+#include "engineTemplate.h"
+#define ENGINE_NAME runSwitch32Unbounded
+#define ENGINE_UNBOUNDED
+#define CELL uint32_t
+#define CELL_BITS 32
+#include "engineTemplate.h"
+
+static const EngineFunction switchEngines[][3] = {
+    [tapeFixed] = {runSwitch8, runSwitch16, runSwitch32},
+    [tapeUnbounded] = {runSwitch8Unbounded, runSwitch16Unbounded, runSwitch32Unbounded},
+    [tapeSparse] = {runSwitch8, runSwitch16, runSwitch32},
+};
+
+enum RunStatus runSwitch(struct Environment *const env)
+{
+    return switchEngines[env->options.tapeMode][env->options.cellBits / 16](env);
+}
+
+#if THREADED_DISPATCH
+// Direct threaded engine: every operation jumps straight to the code of the
+// next one, without going back to a central dispatch loop
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+#define ENGINE_NAME runThreaded8
+#define ENGINE_THREADED
+#define CELL uint8_t
+#define CELL_BITS 8
+#include "engineTemplate.h"
+#define ENGINE_NAME runThreaded16
+#define ENGINE_THREADED
+#define CELL uint16_t
+#define CELL_BITS 16
+#include "engineTemplate.h"
+#define ENGINE_NAME runThreaded32
+#define ENGINE_THREADED
+#define CELL uint32_t
+#define CELL_BITS 32
+#include "engineTemplate.h"
+#define ENGINE_NAME runThreaded8Unbounded
+#define ENGINE_THREADED
+#define ENGINE_UNBOUNDED
+#define CELL uint8_t
+#define CELL_BITS 8
+#include "engineTemplate.h"
+#define ENGINE_NAME runThreaded16Unbounded
+#define ENGINE_THREADED
+#define ENGINE_UNBOUNDED
+#define CELL uint16_t
+#define CELL_BITS 16
+#include "engineTemplate.h"
+#define ENGINE_NAME runThreaded32Unbounded
+#define ENGINE_THREADED
+#define ENGINE_UNBOUNDED
+#define CELL uint32_t
+#define CELL_BITS 32
+#include "engineTemplate.h"
+#pragma GCC diagnostic pop
+
+static const EngineFunction threadedEngines[][3] = {
+    [tapeFixed] = {runThreaded8, runThreaded16, runThreaded32},
+    [tapeUnbounded] = {runThreaded8Unbounded, runThreaded16Unbounded, runThreaded32Unbounded},
+    [tapeSparse] = {runThreaded8, runThreaded16, runThreaded32},
+};
+
+enum RunStatus runThreaded(struct Environment *const env)
+{
+    return threadedEngines[env->options.tapeMode][env->options.cellBits / 16](env);
+}
+#else
+enum RunStatus runThreaded(struct Environment *const env)
+{
+    return runSwitch(env);
+}
+#endif
+
+// Profiling engine, selected instead of the others by the profile mode: the
+// threaded engine, or the switch engine without computed goto, that counts
+// the operations
+#if THREADED_DISPATCH
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+#define PROFILE_THREADED
+#endif
+#define ENGINE_NAME runProfile8
+#define ENGINE_PROFILE
+#ifdef PROFILE_THREADED
+#define ENGINE_THREADED
+#endif
+#define CELL uint8_t
+#define CELL_BITS 8
+#include "engineTemplate.h"
+#define ENGINE_NAME runProfile16
+#define ENGINE_PROFILE
+#ifdef PROFILE_THREADED
+#define ENGINE_THREADED
+#endif
+#define CELL uint16_t
+#define CELL_BITS 16
+#include "engineTemplate.h"
+#define ENGINE_NAME runProfile32
+#define ENGINE_PROFILE
+#ifdef PROFILE_THREADED
+#define ENGINE_THREADED
+#endif
+#define CELL uint32_t
+#define CELL_BITS 32
+#include "engineTemplate.h"
+#define ENGINE_NAME runProfile8Unbounded
+#define ENGINE_PROFILE
+#define ENGINE_UNBOUNDED
+#ifdef PROFILE_THREADED
+#define ENGINE_THREADED
+#endif
+#define CELL uint8_t
+#define CELL_BITS 8
+#include "engineTemplate.h"
+#define ENGINE_NAME runProfile16Unbounded
+#define ENGINE_PROFILE
+#define ENGINE_UNBOUNDED
+#ifdef PROFILE_THREADED
+#define ENGINE_THREADED
+#endif
+#define CELL uint16_t
+#define CELL_BITS 16
+#include "engineTemplate.h"
+#define ENGINE_NAME runProfile32Unbounded
+#define ENGINE_PROFILE
+#define ENGINE_UNBOUNDED
+#ifdef PROFILE_THREADED
+#define ENGINE_THREADED
+#endif
+#define CELL uint32_t
+#define CELL_BITS 32
+#include "engineTemplate.h"
+#ifdef PROFILE_THREADED
+#pragma GCC diagnostic pop
+#undef PROFILE_THREADED
+#endif
+
+static const EngineFunction profileEngines[][3] = {
+    [tapeFixed] = {runProfile8, runProfile16, runProfile32},
+    [tapeUnbounded] = {runProfile8Unbounded, runProfile16Unbounded, runProfile32Unbounded},
+    [tapeSparse] = {runProfile8, runProfile16, runProfile32},
+};
+
+enum RunStatus runProfile(struct Environment *const env)
+{
+    return profileEngines[env->options.tapeMode][env->options.cellBits / 16](env);
+}
+
+// Tracing engine, selected instead of the others while a trace is on, so they
+// don't test it: the same as the profiling one, recording the operations
+#if THREADED_DISPATCH
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+#define TRACE_THREADED
+#endif
+#define ENGINE_NAME runTrace8
+#define ENGINE_TRACE
+#ifdef TRACE_THREADED
+#define ENGINE_THREADED
+#endif
+#define CELL uint8_t
+#define CELL_BITS 8
+#include "engineTemplate.h"
+#define ENGINE_NAME runTrace16
+#define ENGINE_TRACE
+#ifdef TRACE_THREADED
+#define ENGINE_THREADED
+#endif
+#define CELL uint16_t
+#define CELL_BITS 16
+#include "engineTemplate.h"
+#define ENGINE_NAME runTrace32
+#define ENGINE_TRACE
+#ifdef TRACE_THREADED
+#define ENGINE_THREADED
+#endif
+#define CELL uint32_t
+#define CELL_BITS 32
+#include "engineTemplate.h"
+#define ENGINE_NAME runTrace8Unbounded
+#define ENGINE_TRACE
+#define ENGINE_UNBOUNDED
+#ifdef TRACE_THREADED
+#define ENGINE_THREADED
+#endif
+#define CELL uint8_t
+#define CELL_BITS 8
+#include "engineTemplate.h"
+#define ENGINE_NAME runTrace16Unbounded
+#define ENGINE_TRACE
+#define ENGINE_UNBOUNDED
+#ifdef TRACE_THREADED
+#define ENGINE_THREADED
+#endif
+#define CELL uint16_t
+#define CELL_BITS 16
+#include "engineTemplate.h"
+#define ENGINE_NAME runTrace32Unbounded
+#define ENGINE_TRACE
+#define ENGINE_UNBOUNDED
+#ifdef TRACE_THREADED
+#define ENGINE_THREADED
+#endif
+#define CELL uint32_t
+#define CELL_BITS 32
+#include "engineTemplate.h"
+#ifdef TRACE_THREADED
+#pragma GCC diagnostic pop
+#undef TRACE_THREADED
+#endif
+
+static const EngineFunction traceEngines[][3] = {
+    [tapeFixed] = {runTrace8, runTrace16, runTrace32},
+    [tapeUnbounded] = {runTrace8Unbounded, runTrace16Unbounded, runTrace32Unbounded},
+    [tapeSparse] = {runTrace8, runTrace16, runTrace32},
+};
+
+enum RunStatus runTrace(struct Environment *const env)
+{
+    return traceEngines[env->options.tapeMode][env->options.cellBits / 16](env);
+}
+
+//------------------------------------------------------------------------------
+// END
+//------------------------------------------------------------------------------
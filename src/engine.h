@@ -0,0 +1,101 @@
+#ifndef __ENGINE
+#define __ENGINE
+
+//------------------------------------------------------------------------------
+// LIBRARIES
+//------------------------------------------------------------------------------
+
+#include <signal.h>
+#include "brainfuck.h"
+#include "program.h"
+#include "io.h"
+#include "kernels.h"
+
+//------------------------------------------------------------------------------
+// DEFINITIONS
+//------------------------------------------------------------------------------
+
+// Loop iterations between two checks of the budget
+#define BUDGET_CHECK_STEPS (1u << 16)
+
+//------------------------------------------------------------------------------
+// USER TYPES
+//------------------------------------------------------------------------------
+
+struct JitCode;
+struct Profile;
+struct Trace;
+struct SnapshotState;
+struct Prefix;
+
+// Everything a running program uses: nothing else is shared by the engines,
+// apart from the compiled program, which is only read
+struct Environment
+{
+    const struct Program *program;
+    // next operation, or the one that failed
+    const struct Op *op;
+    // loop iterations before the next check of the budget, decremented by the
+    // engines at every jump back to the begin of a loop
+    unsigned long long countdown;
+    unsigned int mIndex;
+    // lowest and highest cells reached, shown by the @ command
+    unsigned int minIndex;
+    unsigned int maxIndex;
+    // cells are cellBits wide, the valid indexes are in [lowIndex, size) and
+    // the first cell of the program is at origin
+    void *mem;
+    unsigned int lowIndex;
+    unsigned int size;
+    unsigned int origin;
+    // memory mapped by the unbounded and sparse tapes, or allocated for the
+    // fixed one, which mem is aligned in
+    unsigned char *mapping;
+    size_t mappingSize;
+    void *allocation;
+    // cells of the paged tapes on the run of touched pages found last by
+    // nextTouchedCell(), until the tape is reset
+    unsigned int touchedLow;
+    unsigned int touchedHigh;
+    // searches the zero cells of the tape a vector at a time
+    ScanKernel scan;
+    struct Options options;
+    // budget of the current run
+    unsigned long long steps;
+    unsigned long long stepLimit;
+    unsigned long long deadline;
+    // reason given by stopEnvironment(), until the next check of the budget
+    volatile sig_atomic_t stopRequest;
+    enum StopReason stopReason;
+    const char *error;
+    struct JitCode *jit;
+    // only in profile mode
+    struct Profile *profile;
+    // only while traceEnvironment() records the operations
+    struct Trace *trace;
+    // pages of the last snapshot, for the incremental ones
+    struct SnapshotState *snapshot;
+    // prefix of the program the tape starts from, until the next run goes
+    // through its steps and output
+    const struct Prefix *prefix;
+    struct OutputBuffer output;
+    struct InputBuffer input;
+};
+
+typedef enum RunStatus (*EngineFunction)(struct Environment *const env);
+
+//------------------------------------------------------------------------------
+// FUNCTION PROTOTYPES
+//------------------------------------------------------------------------------
+
+enum RunStatus runSwitch(struct Environment *const env);
+enum RunStatus runThreaded(struct Environment *const env);
+enum RunStatus runProfile(struct Environment *const env);
+enum RunStatus runTrace(struct Environment *const env);
+int checkBudget(struct Environment *const env);
+void startBudget(struct Environment *const env, const struct Budget *const budget);
+
+//------------------------------------------------------------------------------
+// END
+//------------------------------------------------------------------------------
+#endif // __ENGINE
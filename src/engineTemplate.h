@@ -0,0 +1,266 @@
+// This file has no include guard on purpose: it is included by engine.c once
+// for each execution engine and cell width, with the following macros defined:
+//  ENGINE_NAME     name of the generated function
+//  ENGINE_THREADED if defined, uses computed goto dispatch instead of a switch
+//  CELL            unsigned type of the memory cells, so that they wrap around
+//  CELL_BITS       width of CELL
+//  ENGINE_UNBOUNDED if defined, runs on the unbounded tape: the moves are not
+//                  checked, the guard pages catch the accesses out of the tape
+//  ENGINE_PROFILE  if defined, counts the executions of every operation and
+//                  publishes the current one for the samples of the profiler
+//  ENGINE_TRACE    if defined, records every operation with the cell under the
+//                  pointer, for the trace selected by its filter
+
+#ifdef ENGINE_PROFILE
+#define PROFILE_OPERATION()    \
+    {                          \
+        counts[op - ops]++;    \
+        profile->current = op; \
+    }
+#else
+#define PROFILE_OPERATION()
+#endif
+
+#ifdef ENGINE_TRACE
+// the loop iterations counted in advance by the countdown haven't run yet
+#define TRACE_OPERATION() \
+    traceOperation(trace, env->steps - env->countdown, (unsigned int)(op - ops), op->code, (int)(mIndex - env->origin), (unsigned int)mem[mIndex])
+#else
+#define TRACE_OPERATION()
+#endif
+
+#ifdef ENGINE_THREADED
+#define OPERATION(code)  \
+    label_##code:        \
+    PROFILE_OPERATION(); \
+    TRACE_OPERATION();
+#define NEXT_OPERATION() goto *labels[(++op)->code]
+#else
+#define OPERATION(code)      \
+    case code:               \
+        PROFILE_OPERATION(); \
+        TRACE_OPERATION();
+#define NEXT_OPERATION() \
+    {                    \
+        op++;            \
+        break;           \
+    }
+#endif
+
+#define SAVE_STATE()              \
+    {                             \
+        env->op = op;             \
+        env->mIndex = mIndex;     \
+        env->minIndex = minIndex; \
+        env->maxIndex = maxIndex; \
+    }
+
+#define RUNTIME_ERROR(msg)    \
+    {                         \
+        SAVE_STATE();         \
+        env->error = msg;     \
+        return runError;      \
+    }
+
+#ifdef ENGINE_UNBOUNDED
+// the operation that moved last is the one reported after a fault
+#define CHECK_INDEX(index) env->op = op
+#define TRACK_INDEX(index)                              \
+    {                                                   \
+        minIndex = minIndex < (index) ? minIndex : (index); \
+        maxIndex = maxIndex > (index) ? maxIndex : (index); \
+    }
+#else
+// negative positions wrap around and fail the same comparison
+#define CHECK_INDEX(index)                        \
+    if ((index) >= size)                          \
+    {                                             \
+        RUNTIME_ERROR("Invalid pointer address"); \
+    }
+#define TRACK_INDEX(index) maxIndex = maxIndex > (index) ? maxIndex : (index)
+#endif
+
+static enum RunStatus ENGINE_NAME(struct Environment *const env)
+{
+    const struct Op *const ops = env->program->ops;
+    const struct Op *op = env->op;
+#ifndef ENGINE_UNBOUNDED
+    const unsigned int size = env->size;
+#endif
+    CELL *const mem = (CELL *)env->mem;
+    struct OutputBuffer *const output = &env->output;
+    struct InputBuffer *const input = &env->input;
+    const int debugMode = env->options.debugMode;
+    unsigned int mIndex = env->mIndex;
+    unsigned int minIndex = env->minIndex;
+    unsigned int maxIndex = env->maxIndex;
+#ifdef ENGINE_PROFILE
+    struct Profile *const profile = env->profile;
+    unsigned long long *const counts = profile->counts;
+#endif
+#ifdef ENGINE_TRACE
+    struct Trace *const trace = env->trace;
+#endif
+#ifdef ENGINE_THREADED
+    static const void *const labels[opNum] = {
+        [opMove] = &&label_opMove,
+        [opAdd] = &&label_opAdd,
+        [opOutputByte] = &&label_opOutputByte,
+        [opGetByte] = &&label_opGetByte,
+        [opBeginLoop] = &&label_opBeginLoop,
+        [opEndLoop] = &&label_opEndLoop,
+        [opPrintCell] = &&label_opPrintCell,
+        [opPrintAllCells] = &&label_opPrintAllCells,
+        [opClear] = &&label_opClear,
+        [opMultiply] = &&label_opMultiply,
+        [opScan] = &&label_opScan,
+        [opClearRange] = &&label_opClearRange,
+        [opEnd] = &&label_opEnd,
+    };
+    goto *labels[op->code];
+#else
+    for (;;)
+    {
+        switch (op->code)
+        {
+#endif
+    OPERATION(opMove)
+    {
+        const unsigned int index = mIndex + (unsigned int)op->arg;
+        CHECK_INDEX(index);
+        mIndex = index;
+        TRACK_INDEX(mIndex);
+    }
+    NEXT_OPERATION();
+    OPERATION(opAdd)
+    {
+        mem[mIndex] += (CELL)op->arg;
+    }
+    NEXT_OPERATION();
+    OPERATION(opOutputByte)
+    {
+        writeByte(output, mem[mIndex]);
+    }
+    NEXT_OPERATION();
+    OPERATION(opGetByte)
+    {
+        mem[mIndex] = readByte(input, mem[mIndex]);
+    }
+    NEXT_OPERATION();
+    OPERATION(opBeginLoop)
+    {
+        if (!mem[mIndex])
+        {
+            op = &ops[op->arg];
+        }
+    }
+    NEXT_OPERATION();
+    OPERATION(opEndLoop)
+    {
+        if (mem[mIndex])
+        {
+            // the run stops before jumping back, and continues from the begin of the loop
+            op = &ops[op->arg];
+            if (!--env->countdown && checkBudget(env))
+            {
+                SAVE_STATE();
+                return runStopped;
+            }
+        }
+    }
+    NEXT_OPERATION();
+    OPERATION(opPrintCell)
+    {
+        if (debugMode)
+        {
+            outputPrintf(output, "\ncell %d: %u\n", (int)(mIndex - env->origin), (unsigned int)mem[mIndex]);
+        }
+    }
+    NEXT_OPERATION();
+    OPERATION(opPrintAllCells)
+    {
+        if (debugMode)
+        {
+            outputPrintf(output, "\n");
+            for (unsigned int index = nextTouchedCell(env, minIndex); index <= maxIndex; index = nextTouchedCell(env, index + 1))
+            {
+                outputPrintf(output, "cell %d: %u\n", (int)(index - env->origin), (unsigned int)mem[index]);
+            }
+        }
+    }
+    NEXT_OPERATION();
+    OPERATION(opClear)
+    {
+        mem[mIndex] = 0;
+    }
+    NEXT_OPERATION();
+    OPERATION(opMultiply)
+    {
+        if (mem[mIndex])
+        {
+            const unsigned int index = mIndex + (unsigned int)op->offset;
+            CHECK_INDEX(index);
+            mem[index] += (CELL)(mem[mIndex] * (unsigned int)op->arg);
+            TRACK_INDEX(index);
+        }
+    }
+    NEXT_OPERATION();
+    OPERATION(opScan)
+    {
+        // short scans are stepped through, the longer ones are searched by
+        // the kernel, which doesn't leave the tape
+        for (unsigned int steps = 0; mem[mIndex]; steps++)
+        {
+            if (steps == SCAN_INLINE_STEPS)
+            {
+                const unsigned int index = env->scan(mem, mIndex, op->arg, env->lowIndex, env->size);
+                if (index == env->size)
+                {
+                    RUNTIME_ERROR("Invalid pointer address");
+                }
+                mIndex = index;
+                break;
+            }
+            const unsigned int index = mIndex + (unsigned int)op->arg;
+            CHECK_INDEX(index);
+            mIndex = index;
+        }
+        TRACK_INDEX(mIndex);
+    }
+    NEXT_OPERATION();
+    OPERATION(opClearRange)
+    {
+        const unsigned int index = mIndex + (unsigned int)op->arg;
+        CHECK_INDEX(index);
+        const unsigned int first = op->arg < 0 ? index : mIndex;
+        memset(&mem[first], 0, ((size_t)(op->arg < 0 ? -op->arg : op->arg) + 1) * sizeof(CELL));
+        mIndex = index;
+        TRACK_INDEX(mIndex);
+    }
+    NEXT_OPERATION();
+    OPERATION(opEnd)
+    {
+        SAVE_STATE();
+        return runFinished;
+    }
+#ifndef ENGINE_THREADED
+        }
+    }
+#endif
+}
+
+#undef PROFILE_OPERATION
+#undef TRACE_OPERATION
+#undef OPERATION
+#undef NEXT_OPERATION
+#undef SAVE_STATE
+#undef RUNTIME_ERROR
+#undef CHECK_INDEX
+#undef TRACK_INDEX
+#undef ENGINE_NAME
+#undef ENGINE_THREADED
+#undef ENGINE_UNBOUNDED
+#undef ENGINE_PROFILE
+#undef ENGINE_TRACE
+#undef CELL
+#undef CELL_BITS
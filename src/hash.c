@@ -0,0 +1,32 @@
+//------------------------------------------------------------------------------
+// LIBRARIES
+//------------------------------------------------------------------------------
+
+#include <string.h>
+#include "hash.h"
+
+//------------------------------------------------------------------------------
+// FUNCTIONS
+//------------------------------------------------------------------------------
+
+// FNV-1a, on 64 bits words, continuing from the hash of the data before
+uint64_t hashBytes(uint64_t hash, const void *const data, const size_t size)
+{
+    const unsigned char *const bytes = (const unsigned char *)data;
+    size_t index = 0;
+    for (; index + sizeof(uint64_t) <= size; index += sizeof(uint64_t))
+    {
+        uint64_t word;
+        memcpy(&word, &bytes[index], sizeof(word));
+        hash = (hash ^ word) * HASH_PRIME;
+    }
+    for (; index < size; index++)
+    {
+        hash = (hash ^ bytes[index]) * HASH_PRIME;
+    }
+    return hash;
+}
+
+//------------------------------------------------------------------------------
+// END
+//------------------------------------------------------------------------------
@@ -0,0 +1,29 @@
+#ifndef __HASH
+#define __HASH
+
+//------------------------------------------------------------------------------
+// LIBRARIES
+//------------------------------------------------------------------------------
+
+#include <stddef.h>
+#include <stdint.h>
+
+//------------------------------------------------------------------------------
+// DEFINITIONS
+//------------------------------------------------------------------------------
+
+// FNV-1a, which tells damaged or different data apart, but can be forced to
+// collide, so it doesn't prove that two sources are the same
+#define HASH_BASIS 0xcbf29ce484222325ull
+#define HASH_PRIME 0x100000001b3ull
+
+//------------------------------------------------------------------------------
+// FUNCTION PROTOTYPES
+//------------------------------------------------------------------------------
+
+uint64_t hashBytes(uint64_t hash, const void *const data, const size_t size);
+
+//------------------------------------------------------------------------------
+// END
+//------------------------------------------------------------------------------
+#endif // __HASH
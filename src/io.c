@@ -0,0 +1,270 @@
+//------------------------------------------------------------------------------
+// LIBRARIES
+//------------------------------------------------------------------------------
+
+#define _DEFAULT_SOURCE // writev
+
+#include <errno.h>
+#include <limits.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#include "io.h"
+
+//------------------------------------------------------------------------------
+// FUNCTIONS
+//------------------------------------------------------------------------------
+
+void initOutput(struct OutputBuffer *const output, const struct Io *const io)
+{
+    output->size = 0;
+    output->lineBuffered = io->lineBuffered;
+    output->write = io->write;
+    output->writev = io->writev;
+    output->user = io->user;
+    output->written = 0;
+    limitOutput(output, 0);
+}
+
+// Limits the output of the next run, 0 for unlimited
+void limitOutput(struct OutputBuffer *const output, const unsigned long long bytes)
+{
+    output->remaining = bytes ? bytes : ULLONG_MAX;
+    output->truncated = 0;
+}
+
+static void writeLimited(struct OutputBuffer *const output, const unsigned char *const data, size_t length)
+{
+    if (length > output->remaining)
+    {
+        length = (size_t)output->remaining;
+        output->truncated = 1;
+    }
+    output->remaining -= length;
+    output->written += length;
+    if (length)
+    {
+        // nothing else can be done if the output is gone
+        output->write(output->user, data, length);
+    }
+}
+
+void flushOutput(struct OutputBuffer *const output)
+{
+    if (output->size)
+    {
+        writeLimited(output, output->data, output->size);
+        output->size = 0;
+    }
+}
+
+// Large blocks are written together with the buffered data in a single call
+// if the callbacks allow it, or right after it otherwise, without being
+// copied to the buffer
+void writeBlock(struct OutputBuffer *const output, const void *const data, const size_t length)
+{
+    if (output->size + length <= OUTPUT_BUFFER_SIZE && !output->lineBuffered)
+    {
+        memcpy(&output->data[output->size], data, length);
+        output->size += length;
+        return;
+    }
+    // a block cut by the limit of the run goes through writeLimited()
+    if (output->writev && output->size && output->size + length <= output->remaining)
+    {
+        const struct iovec vectors[2] = {
+            {.iov_base = output->data, .iov_len = output->size},
+            {.iov_base = (void *)data, .iov_len = length},
+        };
+        output->remaining -= output->size + length;
+        output->written += output->size + length;
+        output->writev(output->user, vectors, 2);
+        output->size = 0;
+        return;
+    }
+    flushOutput(output);
+    writeLimited(output, (const unsigned char *)data, length);
+}
+
+void outputPrintf(struct OutputBuffer *const output, const char *const format, ...)
+{
+    char text[256];
+    va_list args;
+    va_start(args, format);
+    const int length = vsnprintf(text, sizeof(text), format, args);
+    va_end(args);
+    if (length > 0)
+    {
+        writeBlock(output, text, (size_t)length < sizeof(text) ? (size_t)length : sizeof(text) - 1);
+    }
+}
+
+void initInput(struct InputBuffer *const input, const struct Io *const io, const enum EofMode eofMode, struct OutputBuffer *const output)
+{
+    input->position = 0;
+    input->size = 0;
+    input->offset = 0;
+    input->skip = 0;
+    input->eofMode = eofMode;
+    input->read = io->read;
+    input->user = io->user;
+    input->output = output;
+}
+
+static int endOfInput(const struct InputBuffer *const input, const int value)
+{
+    switch (input->eofMode)
+    {
+    case eofZero:
+        return 0;
+    case eofUnchanged:
+        return value;
+    default:
+        return EOF;
+    }
+}
+
+// Slow path of readByte(): reads the next block of the input
+int fillInput(struct InputBuffer *const input, const int value)
+{
+    // whoever provides the input may be waiting for the output
+    flushOutput(input->output);
+    input->offset += input->size;
+    input->position = 0;
+    input->size = 0;
+    while (input->skip && input->read)
+    {
+        const size_t skipped = input->read(input->user, input->data, input->skip < INPUT_BUFFER_SIZE ? (size_t)input->skip : INPUT_BUFFER_SIZE);
+        if (!skipped)
+        {
+            break;
+        }
+        input->skip -= skipped;
+        input->offset += skipped;
+    }
+    const size_t length = input->read ? input->read(input->user, input->data, INPUT_BUFFER_SIZE) : 0;
+    if (!length)
+    {
+        return endOfInput(input, value);
+    }
+    input->position = 1;
+    input->size = length;
+    return input->data[0];
+}
+
+// The user data of the descriptor callbacks is a pointer to the descriptor
+size_t writeDescriptor(void *user, const unsigned char *data, size_t size)
+{
+    const int fd = *(const int *)user;
+    size_t written = 0;
+    // retries after partial writes and interruptions
+    while (written < size)
+    {
+        const ssize_t length = write(fd, data + written, size - written);
+        if (length < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (length <= 0)
+        {
+            break;
+        }
+        written += length;
+    }
+    return written;
+}
+
+size_t writevDescriptor(void *user, const struct iovec *vectors, int vectorNum)
+{
+    const int fd = *(const int *)user;
+    size_t written = 0;
+    while (vectorNum)
+    {
+        const ssize_t length = writev(fd, vectors, vectorNum);
+        if (length < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (length <= 0)
+        {
+            break;
+        }
+        written += length;
+        size_t remaining = length;
+        while (vectorNum && remaining >= vectors->iov_len)
+        {
+            remaining -= vectors->iov_len;
+            vectors++;
+            vectorNum--;
+        }
+        if (vectorNum && remaining)
+        {
+            // the vectors can't be changed, so the rest of the one written in
+            // part goes on its own
+            const size_t rest = vectors->iov_len - remaining;
+            const size_t restWritten = writeDescriptor(user, (const unsigned char *)vectors->iov_base + remaining, rest);
+            written += restWritten;
+            if (restWritten < rest)
+            {
+                break;
+            }
+            vectors++;
+            vectorNum--;
+        }
+    }
+    return written;
+}
+
+size_t readDescriptor(void *user, unsigned char *data, size_t size)
+{
+    const int fd = *(const int *)user;
+    ssize_t length;
+    do
+    {
+        length = read(fd, data, size);
+    } while (length < 0 && errno == EINTR);
+    return length > 0 ? (size_t)length : 0;
+}
+
+size_t writeStandardOutput(void *user, const unsigned char *data, size_t size)
+{
+    int fd = STDOUT_FILENO;
+    (void)user;
+    return writeDescriptor(&fd, data, size);
+}
+
+size_t writevStandardOutput(void *user, const struct iovec *vectors, int vectorNum)
+{
+    int fd = STDOUT_FILENO;
+    (void)user;
+    return writevDescriptor(&fd, vectors, vectorNum);
+}
+
+size_t readStandardInput(void *user, unsigned char *data, size_t size)
+{
+    int fd = STDIN_FILENO;
+    (void)user;
+    return readDescriptor(&fd, data, size);
+}
+
+// Interactive input: every key is asked, so the buffer only holds one
+size_t askStandardInput(void *user, unsigned char *data, size_t size)
+{
+    static const char prompt[] = "\nInsert a key:\n";
+    (void)size;
+    writeStandardOutput(user, (const unsigned char *)prompt, sizeof(prompt) - 1);
+    const int key = getchar();
+    writeStandardOutput(user, (const unsigned char *)"\n", 1);
+    if (key == EOF)
+    {
+        return 0;
+    }
+    data[0] = (unsigned char)key;
+    return 1;
+}
+
+//------------------------------------------------------------------------------
+// END
+//------------------------------------------------------------------------------
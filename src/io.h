@@ -0,0 +1,103 @@
+#ifndef __IO
+#define __IO
+
+//------------------------------------------------------------------------------
+// LIBRARIES
+//------------------------------------------------------------------------------
+
+#include <stddef.h>
+#include "brainfuck.h"
+
+//------------------------------------------------------------------------------
+// DEFINITIONS
+//------------------------------------------------------------------------------
+
+#define OUTPUT_BUFFER_SIZE (64 * 1024)
+#define INPUT_BUFFER_SIZE (64 * 1024)
+
+//------------------------------------------------------------------------------
+// USER TYPES
+//------------------------------------------------------------------------------
+
+struct OutputBuffer
+{
+    size_t size;
+    int lineBuffered;
+    // bytes that can still be written in the current run, the next ones
+    // are discarded
+    unsigned long long remaining;
+    int truncated;
+    // bytes written since the program started
+    unsigned long long written;
+    WriteCallback write;
+    WritevCallback writev;
+    void *user;
+    unsigned char data[OUTPUT_BUFFER_SIZE];
+};
+
+struct InputBuffer
+{
+    size_t position;
+    size_t size;
+    // bytes of the input before the buffer, and bytes to skip before the
+    // next block, already consumed before a snapshot
+    unsigned long long offset;
+    unsigned long long skip;
+    enum EofMode eofMode;
+    ReadCallback read;
+    void *user;
+    // flushed before waiting for the input
+    struct OutputBuffer *output;
+    unsigned char data[INPUT_BUFFER_SIZE];
+};
+
+//------------------------------------------------------------------------------
+// FUNCTION PROTOTYPES
+//------------------------------------------------------------------------------
+
+void initOutput(struct OutputBuffer *const output, const struct Io *const io);
+void limitOutput(struct OutputBuffer *const output, const unsigned long long bytes);
+void flushOutput(struct OutputBuffer *const output);
+void writeBlock(struct OutputBuffer *const output, const void *const data, const size_t length);
+void outputPrintf(struct OutputBuffer *const output, const char *const format, ...);
+void initInput(struct InputBuffer *const input, const struct Io *const io, const enum EofMode eofMode, struct OutputBuffer *const output);
+int fillInput(struct InputBuffer *const input, const int value);
+
+// Callbacks on file descriptors and on the standard streams, used by the
+// command line interface
+size_t writeDescriptor(void *user, const unsigned char *data, size_t size);
+size_t writevDescriptor(void *user, const struct iovec *vectors, int vectorNum);
+size_t readDescriptor(void *user, unsigned char *data, size_t size);
+size_t writeStandardOutput(void *user, const unsigned char *data, size_t size);
+size_t writevStandardOutput(void *user, const struct iovec *vectors, int vectorNum);
+size_t readStandardInput(void *user, unsigned char *data, size_t size);
+size_t askStandardInput(void *user, unsigned char *data, size_t size);
+
+//------------------------------------------------------------------------------
+// INLINE FUNCTIONS
+//------------------------------------------------------------------------------
+
+// Called by the engines for every . command, so it only touches the buffer
+static inline void writeByte(struct OutputBuffer *const output, const int value)
+{
+    output->data[output->size++] = (unsigned char)value;
+    if (output->size == OUTPUT_BUFFER_SIZE || (output->lineBuffered && value == '\n'))
+    {
+        flushOutput(output);
+    }
+}
+
+// Called by the engines for every , command, with the current cell value
+static inline int readByte(struct InputBuffer *const input, const int value)
+{
+    if (input->position < input->size)
+    {
+        return input->data[input->position++];
+    }
+    return fillInput(input, value);
+}
+
+//------------------------------------------------------------------------------
+// END
+//------------------------------------------------------------------------------
+#endif // __IO
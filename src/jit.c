@@ -0,0 +1,763 @@
+//------------------------------------------------------------------------------
+// LIBRARIES
+//------------------------------------------------------------------------------
+
+#define _DEFAULT_SOURCE // MAP_ANONYMOUS
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "jit.h"
+#include "io.h"
+#include "tape.h"
+
+#if defined(__x86_64__) && defined(__linux__)
+#include <sys/mman.h>
+#define JIT_SUPPORTED 1
+#else
+#define JIT_SUPPORTED 0
+#endif
+
+#if JIT_SUPPORTED
+
+//------------------------------------------------------------------------------
+// DEFINITIONS
+//------------------------------------------------------------------------------
+
+// Upper bound of the machine code emitted for one operation, including its
+// out of line error stubs and the budget check of the end of loops: a scan,
+// the largest one, takes about 110 bytes with its two stubs
+#define MAX_OP_CODE_SIZE 128
+// Error stubs of one operation: a scan checks the bounds of its inline steps
+// and the result of its kernel
+#define MAX_OP_ERROR_FIXUPS 2
+// Prologue, epilogue and common error handler
+#define MAX_FIXED_CODE_SIZE 256
+
+//------------------------------------------------------------------------------
+// USER TYPES
+//------------------------------------------------------------------------------
+
+// The generated code keeps its state in callee saved registers:
+//  rbx: lowest cell reached, which is the start of the fixed size tape
+//       (only updated in debug mode, on the unbounded tape)
+//  r12: current cell
+//  r13: end of the tape
+//  r14: highest cell reached (only updated in debug and snapshot modes)
+//  r15: environment, passed to the callbacks
+// The code starts at the operation given by start, to resume a stopped run,
+// and returns a RunStatus.
+typedef int (*JitFunction)(struct Environment *env, unsigned char *minCell, unsigned char *cell, unsigned char *end, unsigned char *maxCell, const unsigned char *start);
+
+// Generic function pointer type, used to embed the callback addresses in the code
+typedef void (*Callback)(void);
+
+// Position of a 32 bits relative jump whose destination is only known later
+struct Fixup
+{
+    size_t position;
+    unsigned int opIdx;
+};
+
+struct CodeBuffer
+{
+    unsigned char *code;
+    size_t size;
+    size_t capacity;
+    // options the code is specialized for
+    unsigned int cellBits;
+    int debugMode;
+    int trackCells;
+    enum TapeMode tapeMode;
+    size_t epilogue;
+    // beginning of the machine code of each operation
+    size_t *opOffsets;
+    // forward jumps to the end of loops
+    struct Fixup *loopFixups;
+    unsigned int loopFixupNum;
+    // jumps to the error stubs
+    struct Fixup *errorFixups;
+    unsigned int errorFixupNum;
+};
+
+// Translation of the program for one environment, kept between its runs
+struct JitCode
+{
+    // NULL if the program can't be translated
+    void *code;
+    size_t codeSize;
+    size_t *opOffsets;
+};
+
+//------------------------------------------------------------------------------
+// CALLBACKS
+//------------------------------------------------------------------------------
+
+// Value of the cell at the given address, which is cellBits wide
+static unsigned int cellValue(const struct Environment *const env, const unsigned char *const cell)
+{
+    switch (env->options.cellBits)
+    {
+    case 8:
+        return *cell;
+    case 16:
+        return *(const uint16_t *)cell;
+    default:
+        return *(const uint32_t *)cell;
+    }
+}
+
+static unsigned int cellIndex(const struct Environment *const env, const unsigned char *const cell)
+{
+    return (cell - (const unsigned char *)env->mem) / (env->options.cellBits / 8);
+}
+
+static void jitOutputByte(struct Environment *const env, const int value)
+{
+    writeByte(&env->output, value);
+}
+
+static int jitGetByte(struct Environment *const env, const int value)
+{
+    return readByte(&env->input, value);
+}
+
+static void jitPrintCell(struct Environment *const env, const unsigned char *const cell)
+{
+    outputPrintf(&env->output, "\ncell %d: %u\n", (int)(cellIndex(env, cell) - env->origin), cellValue(env, cell));
+}
+
+static void jitPrintAllCells(struct Environment *const env, const unsigned char *const minCell, const unsigned char *const maxCell)
+{
+    outputPrintf(&env->output, "\n");
+    const unsigned char *const mem = (const unsigned char *)env->mem;
+    const unsigned int maxIndex = cellIndex(env, maxCell);
+    for (unsigned int index = nextTouchedCell(env, cellIndex(env, minCell)); index <= maxIndex; index = nextTouchedCell(env, index + 1))
+    {
+        outputPrintf(&env->output, "cell %d: %u\n", (int)(index - env->origin), cellValue(env, &mem[(size_t)index * (env->options.cellBits / 8)]));
+    }
+}
+
+// Saves the registers in the environment, where the next run starts from
+static void jitLeave(struct Environment *const env, const unsigned char *const cell, const unsigned char *const minCell, const unsigned char *const maxCell, const unsigned int opIdx)
+{
+    env->mIndex = cellIndex(env, cell);
+    env->minIndex = cellIndex(env, minCell);
+    env->maxIndex = cellIndex(env, maxCell);
+    env->op = &env->program->ops[opIdx];
+}
+
+// Continues a long scan with the kernel of the tape: returns the zero cell it
+// found, or NULL if the scan leaves the tape
+static unsigned char *jitScan(struct Environment *const env, const unsigned char *const cell, const int stride)
+{
+    const unsigned int index = env->scan(env->mem, cellIndex(env, cell), stride, env->lowIndex, env->size);
+    if (index == env->size)
+    {
+        return NULL;
+    }
+    return (unsigned char *)env->mem + (size_t)index * (env->options.cellBits / 8);
+}
+
+static void jitError(struct Environment *const env, const unsigned int opIdx)
+{
+    env->op = &env->program->ops[opIdx];
+    env->error = "Invalid pointer address";
+}
+
+//------------------------------------------------------------------------------
+// CODE EMISSION
+//------------------------------------------------------------------------------
+
+static void emit(struct CodeBuffer *const buffer, const unsigned char *const bytes, const size_t length)
+{
+    memcpy(&buffer->code[buffer->size], bytes, length);
+    buffer->size += length;
+}
+
+#define EMIT(buffer, ...)                                       \
+    {                                                           \
+        const unsigned char bytes[] = {__VA_ARGS__};            \
+        emit(buffer, bytes, sizeof(bytes));                     \
+    }
+
+static void emit32(struct CodeBuffer *const buffer, const int value)
+{
+    memcpy(&buffer->code[buffer->size], &value, sizeof(value));
+    buffer->size += sizeof(value);
+}
+
+static void patch32(struct CodeBuffer *const buffer, const size_t position, const size_t destination)
+{
+    // relative to the end of the jump instruction
+    const int displacement = (int)(destination - (position + 4));
+    memcpy(&buffer->code[position], &displacement, sizeof(displacement));
+}
+
+// mov rax, function; call rax
+static void emitCall(struct CodeBuffer *const buffer, Callback function)
+{
+    EMIT(buffer, 0x48, 0xB8);
+    memcpy(&buffer->code[buffer->size], &function, sizeof(function));
+    buffer->size += sizeof(function);
+    EMIT(buffer, 0xFF, 0xD0);
+}
+
+// Conditional jump (0F xx rel32) to the error stub of the operation
+static void emitErrorJump(struct CodeBuffer *const buffer, const unsigned char condition, const unsigned int opIdx)
+{
+    EMIT(buffer, 0x0F, condition);
+    buffer->errorFixups[buffer->errorFixupNum++] = (struct Fixup){.position = buffer->size, .opIdx = opIdx};
+    emit32(buffer, 0);
+}
+
+// Checks the pointer in r12 (or rdx) against the tape limit in the direction it moved.
+// The unbounded tape is not checked, the guard pages catch the accesses out
+// of it: the operation is only recorded in the environment, for the error.
+static void emitBoundsCheck(struct CodeBuffer *const buffer, const struct Program *const program, const int useRdx, const int forward, const unsigned int opIdx)
+{
+    if (buffer->tapeMode == tapeUnbounded)
+    {
+        // mov rcx, op; mov [r15 + op], rcx
+        const struct Op *const op = &program->ops[opIdx];
+        EMIT(buffer, 0x48, 0xB9);
+        memcpy(&buffer->code[buffer->size], &op, sizeof(op));
+        buffer->size += sizeof(op);
+        EMIT(buffer, 0x49, 0x89, 0x4F, (unsigned char)offsetof(struct Environment, op));
+    }
+    else if (forward)
+    {
+        // cmp r12, r13 / cmp rdx, r13; jae error
+        if (useRdx)
+        {
+            EMIT(buffer, 0x4C, 0x39, 0xEA);
+        }
+        else
+        {
+            EMIT(buffer, 0x4D, 0x39, 0xEC);
+        }
+        emitErrorJump(buffer, 0x83, opIdx);
+    }
+    else
+    {
+        // cmp r12, rbx / cmp rdx, rbx; jb error
+        if (useRdx)
+        {
+            EMIT(buffer, 0x48, 0x39, 0xDA);
+        }
+        else
+        {
+            EMIT(buffer, 0x49, 0x39, 0xDC);
+        }
+        emitErrorJump(buffer, 0x82, opIdx);
+    }
+}
+
+static void emitTrackMax(struct CodeBuffer *const buffer, const int useRdx)
+{
+    // only the @ command and the snapshots use the lowest and highest cells
+    // reached
+    if (buffer->trackCells && buffer->tapeMode == tapeUnbounded && useRdx)
+    {
+        // cmp rdx, rbx; cmovb rbx, rdx
+        EMIT(buffer, 0x48, 0x39, 0xDA, 0x48, 0x0F, 0x42, 0xDA);
+    }
+    else if (buffer->trackCells && buffer->tapeMode == tapeUnbounded)
+    {
+        // cmp r12, rbx; cmovb rbx, r12
+        EMIT(buffer, 0x49, 0x39, 0xDC, 0x49, 0x0F, 0x42, 0xDC);
+    }
+    if (buffer->trackCells && useRdx)
+    {
+        // cmp rdx, r14; cmova r14, rdx
+        EMIT(buffer, 0x4C, 0x39, 0xF2, 0x4C, 0x0F, 0x47, 0xF2);
+    }
+    else if (buffer->trackCells)
+    {
+        // cmp r12, r14; cmova r14, r12
+        EMIT(buffer, 0x4D, 0x39, 0xF4, 0x4D, 0x0F, 0x47, 0xF4);
+    }
+}
+
+static int fitsDisplacement(const struct CodeBuffer *const buffer, const int cells)
+{
+    const long long bytes = (long long)cells * (buffer->cellBits / 8);
+    return (bytes >= -0x7FFFFFFFLL && bytes <= 0x7FFFFFFFLL);
+}
+
+// The cell instructions are selected by the cell width: the 16 bits forms are
+// the 32 bits ones with an operand size prefix, the 8 bits forms have their
+// own opcodes. Cells are loaded zero extended, as they are unsigned.
+
+// movzx / mov reg, [r12], where reg is encoded in the ModRM byte
+static void emitLoadCell(struct CodeBuffer *const buffer, const unsigned char modrm)
+{
+    switch (buffer->cellBits)
+    {
+    case 8:
+        EMIT(buffer, 0x41, 0x0F, 0xB6, modrm, 0x24);
+        break;
+    case 16:
+        EMIT(buffer, 0x41, 0x0F, 0xB7, modrm, 0x24);
+        break;
+    default:
+        EMIT(buffer, 0x41, 0x8B, modrm, 0x24);
+        break;
+    }
+}
+
+// mov [r12], al / ax / eax
+static void emitStoreCell(struct CodeBuffer *const buffer)
+{
+    switch (buffer->cellBits)
+    {
+    case 8:
+        EMIT(buffer, 0x41, 0x88, 0x04, 0x24);
+        break;
+    case 16:
+        EMIT(buffer, 0x66, 0x41, 0x89, 0x04, 0x24);
+        break;
+    default:
+        EMIT(buffer, 0x41, 0x89, 0x04, 0x24);
+        break;
+    }
+}
+
+// cmp [r12], 0
+static void emitTestCell(struct CodeBuffer *const buffer)
+{
+    switch (buffer->cellBits)
+    {
+    case 8:
+        EMIT(buffer, 0x41, 0x80, 0x3C, 0x24, 0x00);
+        break;
+    case 16:
+        EMIT(buffer, 0x66, 0x41, 0x83, 0x3C, 0x24, 0x00);
+        break;
+    default:
+        EMIT(buffer, 0x41, 0x83, 0x3C, 0x24, 0x00);
+        break;
+    }
+}
+
+static int emitOp(struct CodeBuffer *const buffer, const struct Program *const program, const unsigned int opIdx)
+{
+    const struct Op *const op = &program->ops[opIdx];
+    buffer->opOffsets[opIdx] = buffer->size;
+    switch (op->code)
+    {
+    case opMove:
+        if (!fitsDisplacement(buffer, op->arg))
+        {
+            return EXIT_FAILURE;
+        }
+        // add r12, arg
+        EMIT(buffer, 0x49, 0x81, 0xC4);
+        emit32(buffer, op->arg * (int)(buffer->cellBits / 8));
+        emitBoundsCheck(buffer, program, 0, op->arg > 0, opIdx);
+        emitTrackMax(buffer, 0);
+        break;
+    case opAdd:
+        // add [r12], arg
+        if (buffer->cellBits == 8)
+        {
+            EMIT(buffer, 0x41, 0x80, 0x04, 0x24, op->arg & 0xFF);
+        }
+        else if (buffer->cellBits == 16)
+        {
+            EMIT(buffer, 0x66, 0x41, 0x81, 0x04, 0x24, op->arg & 0xFF, (op->arg >> 8) & 0xFF);
+        }
+        else
+        {
+            EMIT(buffer, 0x41, 0x81, 0x04, 0x24);
+            emit32(buffer, op->arg);
+        }
+        break;
+    case opClear:
+        // mov [r12], 0
+        if (buffer->cellBits == 8)
+        {
+            EMIT(buffer, 0x41, 0xC6, 0x04, 0x24, 0x00);
+        }
+        else if (buffer->cellBits == 16)
+        {
+            EMIT(buffer, 0x66, 0x41, 0xC7, 0x04, 0x24, 0x00, 0x00);
+        }
+        else
+        {
+            EMIT(buffer, 0x41, 0xC7, 0x04, 0x24, 0x00, 0x00, 0x00, 0x00);
+        }
+        break;
+    case opMultiply:
+    {
+        if (!fitsDisplacement(buffer, op->offset))
+        {
+            return EXIT_FAILURE;
+        }
+        // mov eax, [r12]; test eax, eax; jz skip
+        emitLoadCell(buffer, 0x04);
+        EMIT(buffer, 0x85, 0xC0, 0x74, 0x00);
+        const size_t skip = buffer->size;
+        // lea rdx, [r12 + offset]
+        EMIT(buffer, 0x49, 0x8D, 0x94, 0x24);
+        emit32(buffer, op->offset * (int)(buffer->cellBits / 8));
+        emitBoundsCheck(buffer, program, 1, op->offset > 0, opIdx);
+        // imul eax, eax, factor; add [rdx], al / ax / eax
+        EMIT(buffer, 0x69, 0xC0);
+        emit32(buffer, op->arg);
+        if (buffer->cellBits == 8)
+        {
+            EMIT(buffer, 0x00, 0x02);
+        }
+        else if (buffer->cellBits == 16)
+        {
+            EMIT(buffer, 0x66, 0x01, 0x02);
+        }
+        else
+        {
+            EMIT(buffer, 0x01, 0x02);
+        }
+        emitTrackMax(buffer, 1);
+        buffer->code[skip - 1] = (unsigned char)(buffer->size - skip);
+        break;
+    }
+    case opScan:
+    {
+        if (!fitsDisplacement(buffer, op->arg))
+        {
+            return EXIT_FAILURE;
+        }
+        // mov esi, steps; loop: cmp [r12], 0; je done
+        EMIT(buffer, 0xBE);
+        emit32(buffer, SCAN_INLINE_STEPS);
+        const size_t loop = buffer->size;
+        emitTestCell(buffer);
+        EMIT(buffer, 0x0F, 0x84);
+        const size_t done = buffer->size;
+        emit32(buffer, 0);
+        // dec esi; jz kernel
+        EMIT(buffer, 0xFF, 0xCE, 0x0F, 0x84);
+        const size_t kernel = buffer->size;
+        emit32(buffer, 0);
+        // add r12, stride; check bounds; jmp loop
+        EMIT(buffer, 0x49, 0x81, 0xC4);
+        emit32(buffer, op->arg * (int)(buffer->cellBits / 8));
+        emitBoundsCheck(buffer, program, 0, op->arg > 0, opIdx);
+        EMIT(buffer, 0xE9);
+        emit32(buffer, 0);
+        patch32(buffer, buffer->size - 4, loop);
+        // kernel: mov rdi, r15; mov rsi, r12; mov edx, stride; call;
+        // test rax, rax; jz error; mov r12, rax
+        patch32(buffer, kernel, buffer->size);
+        EMIT(buffer, 0x4C, 0x89, 0xFF, 0x4C, 0x89, 0xE6, 0xBA);
+        emit32(buffer, op->arg);
+        emitCall(buffer, (Callback)jitScan);
+        EMIT(buffer, 0x48, 0x85, 0xC0);
+        emitErrorJump(buffer, 0x84, opIdx);
+        EMIT(buffer, 0x49, 0x89, 0xC4);
+        patch32(buffer, done, buffer->size);
+        emitTrackMax(buffer, 0);
+        break;
+    }
+    case opClearRange:
+    {
+        const int length = ((op->arg < 0 ? -op->arg : op->arg) + 1) * (int)(buffer->cellBits / 8);
+        if (!fitsDisplacement(buffer, op->arg))
+        {
+            return EXIT_FAILURE;
+        }
+        // lea rdx, [r12 + distance]; check bounds
+        EMIT(buffer, 0x49, 0x8D, 0x94, 0x24);
+        emit32(buffer, op->arg * (int)(buffer->cellBits / 8));
+        emitBoundsCheck(buffer, program, 1, op->arg > 0, opIdx);
+        // mov rdi, r12 / mov rdi, rdx: the lowest cell of the range
+        if (op->arg > 0)
+        {
+            EMIT(buffer, 0x4C, 0x89, 0xE7);
+        }
+        else
+        {
+            EMIT(buffer, 0x48, 0x89, 0xD7);
+        }
+        if (length > 64)
+        {
+            // xor eax, eax; mov ecx, length; rep stosb
+            EMIT(buffer, 0x31, 0xC0, 0xB9);
+            emit32(buffer, length);
+            EMIT(buffer, 0xF3, 0xAA);
+        }
+        else if (length >= 16)
+        {
+            // pxor xmm0, xmm0; movdqu [rdi + offset], xmm0 for every 16 bytes,
+            // the last store overlapping the previous one
+            EMIT(buffer, 0x66, 0x0F, 0xEF, 0xC0);
+            for (int offset = 0; offset < length - 16; offset += 16)
+            {
+                EMIT(buffer, 0xF3, 0x0F, 0x7F, 0x47, (unsigned char)offset);
+            }
+            EMIT(buffer, 0xF3, 0x0F, 0x7F, 0x47, (unsigned char)(length - 16));
+        }
+        else
+        {
+            // xor eax, eax; mov [rdi], rax / eax / ax; mov [rdi + length - width], rax / eax / ax
+            EMIT(buffer, 0x31, 0xC0);
+            if (length >= 8)
+            {
+                EMIT(buffer, 0x48, 0x89, 0x07, 0x48, 0x89, 0x47, (unsigned char)(length - 8));
+            }
+            else if (length >= 4)
+            {
+                EMIT(buffer, 0x89, 0x07, 0x89, 0x47, (unsigned char)(length - 4));
+            }
+            else
+            {
+                EMIT(buffer, 0x66, 0x89, 0x07, 0x66, 0x89, 0x47, (unsigned char)(length - 2));
+            }
+        }
+        // mov r12, rdx
+        EMIT(buffer, 0x49, 0x89, 0xD4);
+        emitTrackMax(buffer, 0);
+        break;
+    }
+    case opBeginLoop:
+        // cmp [r12], 0; je after the end of loop
+        emitTestCell(buffer);
+        EMIT(buffer, 0x0F, 0x84);
+        buffer->loopFixups[buffer->loopFixupNum++] = (struct Fixup){.position = buffer->size, .opIdx = op->arg + 1};
+        emit32(buffer, 0);
+        break;
+    case opEndLoop:
+    {
+        // cmp [r12], 0; je after; dec [r15 + countdown]; jnz after the begin of loop
+        emitTestCell(buffer);
+        EMIT(buffer, 0x0F, 0x84);
+        const size_t after = buffer->size;
+        emit32(buffer, 0);
+        EMIT(buffer, 0x49, 0xFF, 0x4F, (unsigned char)offsetof(struct Environment, countdown), 0x0F, 0x85);
+        emit32(buffer, 0);
+        patch32(buffer, buffer->size - 4, buffer->opOffsets[op->arg + 1]);
+        // the countdown ran out: mov rdi, r15; call; test eax, eax; jz after the begin of loop
+        EMIT(buffer, 0x4C, 0x89, 0xFF);
+        emitCall(buffer, (Callback)checkBudget);
+        EMIT(buffer, 0x85, 0xC0, 0x0F, 0x84);
+        emit32(buffer, 0);
+        patch32(buffer, buffer->size - 4, buffer->opOffsets[op->arg + 1]);
+        // the run stops, and resumes at the begin of loop:
+        // mov rdi, r15; mov rsi, r12; mov rdx, rbx; mov rcx, r14; mov r8d, begin; call
+        EMIT(buffer, 0x4C, 0x89, 0xFF, 0x4C, 0x89, 0xE6, 0x48, 0x89, 0xDA, 0x4C, 0x89, 0xF1, 0x41, 0xB8);
+        emit32(buffer, op->arg);
+        emitCall(buffer, (Callback)jitLeave);
+        // mov eax, runStopped; jmp epilogue
+        EMIT(buffer, 0xB8, runStopped, 0x00, 0x00, 0x00, 0xE9);
+        emit32(buffer, 0);
+        patch32(buffer, buffer->size - 4, buffer->epilogue);
+        patch32(buffer, after, buffer->size);
+        break;
+    }
+    case opOutputByte:
+        // mov rdi, r15; mov esi, [r12]; call
+        EMIT(buffer, 0x4C, 0x89, 0xFF);
+        emitLoadCell(buffer, 0x34);
+        emitCall(buffer, (Callback)jitOutputByte);
+        break;
+    case opGetByte:
+        // mov rdi, r15; mov esi, [r12]; call; mov [r12], eax
+        EMIT(buffer, 0x4C, 0x89, 0xFF);
+        emitLoadCell(buffer, 0x34);
+        emitCall(buffer, (Callback)jitGetByte);
+        emitStoreCell(buffer);
+        break;
+    case opPrintCell:
+        if (buffer->debugMode)
+        {
+            // mov rdi, r15; mov rsi, r12; call
+            EMIT(buffer, 0x4C, 0x89, 0xFF, 0x4C, 0x89, 0xE6);
+            emitCall(buffer, (Callback)jitPrintCell);
+        }
+        break;
+    case opPrintAllCells:
+        if (buffer->debugMode)
+        {
+            // mov rdi, r15; mov rsi, rbx; mov rdx, r14; call
+            EMIT(buffer, 0x4C, 0x89, 0xFF, 0x48, 0x89, 0xDE, 0x4C, 0x89, 0xF2);
+            emitCall(buffer, (Callback)jitPrintAllCells);
+        }
+        break;
+    case opEnd:
+        // mov rdi, r15; mov rsi, r12; mov rdx, rbx; mov rcx, r14; mov r8d, opIdx; call
+        EMIT(buffer, 0x4C, 0x89, 0xFF, 0x4C, 0x89, 0xE6, 0x48, 0x89, 0xDA, 0x4C, 0x89, 0xF1, 0x41, 0xB8);
+        emit32(buffer, opIdx);
+        emitCall(buffer, (Callback)jitLeave);
+        // xor eax, eax; jmp epilogue
+        EMIT(buffer, 0x31, 0xC0, 0xE9);
+        emit32(buffer, 0);
+        patch32(buffer, buffer->size - 4, buffer->epilogue);
+        break;
+    }
+    return EXIT_SUCCESS;
+}
+
+static void emitPrologue(struct CodeBuffer *const buffer)
+{
+    // push rbp, rbx, r12, r13, r14, r15; sub rsp, 8 (keeps the stack aligned for calls)
+    EMIT(buffer, 0x55, 0x53, 0x41, 0x54, 0x41, 0x55, 0x41, 0x56, 0x41, 0x57, 0x48, 0x83, 0xEC, 0x08);
+    // mov r15, rdi; mov rbx, rsi; mov r12, rdx; mov r13, rcx; mov r14, r8; jmp r9
+    EMIT(buffer, 0x49, 0x89, 0xFF, 0x48, 0x89, 0xF3, 0x49, 0x89, 0xD4, 0x49, 0x89, 0xCD, 0x4D, 0x89, 0xC6, 0x41, 0xFF, 0xE1);
+}
+
+// Right after the prologue, so that the operations jump back to it
+static void emitEpilogue(struct CodeBuffer *const buffer)
+{
+    // add rsp, 8; pop r15, r14, r13, r12, rbx, rbp; ret
+    buffer->epilogue = buffer->size;
+    EMIT(buffer, 0x48, 0x83, 0xC4, 0x08, 0x41, 0x5F, 0x41, 0x5E, 0x41, 0x5D, 0x41, 0x5C, 0x5B, 0x5D, 0xC3);
+}
+
+// Error stubs live after the code, so the fast path only has not taken branches
+static void emitErrorStubs(struct CodeBuffer *const buffer)
+{
+    size_t handler = 0;
+    if (buffer->errorFixupNum)
+    {
+        // mov rdi, r15; call; mov eax, runError; jmp epilogue
+        handler = buffer->size;
+        EMIT(buffer, 0x4C, 0x89, 0xFF);
+        emitCall(buffer, (Callback)jitError);
+        EMIT(buffer, 0xB8, runError, 0x00, 0x00, 0x00, 0xE9);
+        emit32(buffer, 0);
+        patch32(buffer, buffer->size - 4, buffer->epilogue);
+    }
+    for (unsigned int fixupIdx = 0; fixupIdx < buffer->errorFixupNum; fixupIdx++)
+    {
+        patch32(buffer, buffer->errorFixups[fixupIdx].position, buffer->size);
+        // mov esi, opIdx; jmp handler
+        EMIT(buffer, 0xBE);
+        emit32(buffer, buffer->errorFixups[fixupIdx].opIdx);
+        EMIT(buffer, 0xE9);
+        emit32(buffer, 0);
+        patch32(buffer, buffer->size - 4, handler);
+    }
+}
+
+static int translate(struct CodeBuffer *const buffer, const struct Program *const program)
+{
+    emitPrologue(buffer);
+    emitEpilogue(buffer);
+    for (unsigned int opIdx = 0; opIdx < program->opNum; opIdx++)
+    {
+        if (emitOp(buffer, program, opIdx))
+        {
+            return EXIT_FAILURE;
+        }
+    }
+    emitErrorStubs(buffer);
+    for (unsigned int fixupIdx = 0; fixupIdx < buffer->loopFixupNum; fixupIdx++)
+    {
+        patch32(buffer, buffer->loopFixups[fixupIdx].position, buffer->opOffsets[buffer->loopFixups[fixupIdx].opIdx]);
+    }
+    return EXIT_SUCCESS;
+}
+
+static void compileJit(struct JitCode *const jit, const struct Program *const program, const struct Options *const options)
+{
+    struct CodeBuffer buffer = {
+        .code = NULL,
+        .size = 0,
+        .capacity = (size_t)program->opNum * MAX_OP_CODE_SIZE + MAX_FIXED_CODE_SIZE,
+        .cellBits = options->cellBits,
+        .debugMode = options->debugMode,
+        .trackCells = options->debugMode || options->snapshotMode,
+        .tapeMode = options->tapeMode,
+        .epilogue = 0,
+        .opOffsets = (size_t *)malloc(program->opNum * sizeof(size_t)),
+        .loopFixups = (struct Fixup *)malloc(program->opNum * sizeof(struct Fixup)),
+        .loopFixupNum = 0,
+        .errorFixups = (struct Fixup *)malloc((size_t)program->opNum * MAX_OP_ERROR_FIXUPS * sizeof(struct Fixup)),
+        .errorFixupNum = 0,
+    };
+    void *code = NULL;
+    if (buffer.opOffsets && buffer.loopFixups && buffer.errorFixups)
+    {
+        code = mmap(NULL, buffer.capacity, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (code == MAP_FAILED)
+        {
+            code = NULL;
+        }
+        else
+        {
+            buffer.code = (unsigned char *)code;
+            // the code is never writable and executable at the same time
+            if (translate(&buffer, program) || mprotect(code, buffer.capacity, PROT_READ | PROT_EXEC))
+            {
+                munmap(code, buffer.capacity);
+                code = NULL;
+            }
+        }
+    }
+    free((void *)buffer.loopFixups);
+    free((void *)buffer.errorFixups);
+    jit->code = code;
+    jit->codeSize = buffer.capacity;
+    // the offsets are the entry points of the next runs
+    jit->opOffsets = buffer.opOffsets;
+}
+
+enum RunStatus runJit(struct Environment *const env)
+{
+    if (!env->jit)
+    {
+        // translated on the first run, for the options of the environment
+        env->jit = (struct JitCode *)malloc(sizeof(struct JitCode));
+        if (!env->jit)
+        {
+            return runThreaded(env);
+        }
+        compileJit(env->jit, env->program, &env->options);
+    }
+    if (!env->jit->code)
+    {
+        // the program can't be translated, so it is interpreted instead
+        return runThreaded(env);
+    }
+    union
+    {
+        void *code;
+        JitFunction function;
+    } entry = {.code = env->jit->code};
+    unsigned char *const mem = (unsigned char *)env->mem;
+    const size_t cellSize = env->options.cellBits / 8;
+    const unsigned char *const start = (const unsigned char *)env->jit->code + env->jit->opOffsets[env->op - env->program->ops];
+    return (enum RunStatus)entry.function(env, &mem[env->minIndex * cellSize], &mem[env->mIndex * cellSize], &mem[env->size * cellSize], &mem[env->maxIndex * cellSize], start);
+}
+
+void freeJit(struct JitCode *const jit)
+{
+    if (jit)
+    {
+        if (jit->code)
+        {
+            munmap(jit->code, jit->codeSize);
+        }
+        free((void *)jit->opOffsets);
+        free((void *)jit);
+    }
+}
+
+#else
+
+enum RunStatus runJit(struct Environment *const env)
+{
+    return runThreaded(env);
+}
+
+void freeJit(struct JitCode *const jit)
+{
+    (void)jit;
+}
+
+#endif
+
+//------------------------------------------------------------------------------
+// END
+//------------------------------------------------------------------------------
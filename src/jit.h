@@ -0,0 +1,23 @@
+#ifndef __JIT
+#define __JIT
+
+//------------------------------------------------------------------------------
+// LIBRARIES
+//------------------------------------------------------------------------------
+
+#include "engine.h"
+
+//------------------------------------------------------------------------------
+// FUNCTION PROTOTYPES
+//------------------------------------------------------------------------------
+
+// Translates the program to x86-64 machine code and runs it. On other
+// architectures, or if the translation fails, the program is interpreted.
+// The translation is kept in the environment until freeJit().
+enum RunStatus runJit(struct Environment *const env);
+void freeJit(struct JitCode *const jit);
+
+//------------------------------------------------------------------------------
+// END
+//------------------------------------------------------------------------------
+#endif // __JIT
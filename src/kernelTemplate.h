@@ -0,0 +1,150 @@
+// This file has no include guard on purpose: it is included by kernels.c once
+// for each instruction set and cell width, with the following macros defined:
+//  KERNEL_NAME     name of the generated scan kernel
+//  KERNEL_AVX2     if defined, reads 32 bytes windows with AVX2 instead of 16
+//                  bytes windows with SSE2
+//  KERNEL_COMPARE  intrinsic comparing the cells of two vectors for equality
+//  CELL            unsigned type of the cells
+//
+// The tape is searched an aligned window at a time: every cell of the window
+// is compared with zero at once, and the zero cells that are steps of the scan
+// are picked with a mask of candidates. Aligned windows never cross a page,
+// and the fixed tape is aligned and padded to whole windows, so the cells
+// read around the ones of the scan always exist.
+
+#define CELL_BYTES ((long long)sizeof(CELL))
+
+#ifdef KERNEL_AVX2
+#define WINDOW_BYTES 32
+#define WINDOW_MASK 0xFFFFFFFFu
+#define KERNEL_TARGET __attribute__((target("avx2")))
+#define ZERO_MASK(window) ((uint32_t)_mm256_movemask_epi8(KERNEL_COMPARE(_mm256_load_si256((const __m256i *)(window)), _mm256_setzero_si256())))
+#else
+#define WINDOW_BYTES 16
+#define WINDOW_MASK 0xFFFFu
+#define KERNEL_TARGET
+#define ZERO_MASK(window) ((uint32_t)_mm_movemask_epi8(KERNEL_COMPARE(_mm_load_si128((const __m128i *)(window)), _mm_setzero_si128())))
+#endif
+
+KERNEL_TARGET static unsigned int KERNEL_NAME(const void *const mem, const unsigned int index, const int stride, const unsigned int low, const unsigned int high)
+{
+    const unsigned char *const bytes = (const unsigned char *)mem;
+    // byte offsets from the start of the tape, which is aligned
+    const long long step = (stride < 0 ? -(long long)stride : stride) * CELL_BYTES;
+    const long long first = (long long)low * CELL_BYTES;
+    const long long last = (long long)high * CELL_BYTES;
+    const long long start = (long long)index * CELL_BYTES;
+    long long window = start - start % WINDOW_BYTES;
+    // the candidates of a window are a pattern of bits one step apart, shifted
+    // by the phase, the distance of the first candidate from the edge where the
+    // scan enters the window, which goes down by phaseShift (modulo the step)
+    // from one window to the next
+    const long long stepInWindow = step < WINDOW_BYTES ? step : WINDOW_BYTES;
+    const unsigned int phaseShift = (unsigned int)(WINDOW_BYTES % step);
+    if (phaseShift && 4 * step > WINDOW_BYTES)
+    {
+        // too few candidates in a window to pay for its masks: the cells are
+        // read one at a time, the indexes out of the range wrapping around
+        const CELL *const cells = (const CELL *)mem;
+        unsigned int next = index;
+        while (cells[next])
+        {
+            next += (unsigned int)stride;
+            if (next - low >= high - low)
+            {
+                return high;
+            }
+        }
+        return next;
+    }
+    uint32_t pattern = 0;
+    for (long long bit = 0; bit < WINDOW_BYTES; bit += stepInWindow)
+    {
+        pattern |= (uint32_t)1 << (stride > 0 ? bit : WINDOW_BYTES - 1 - bit);
+    }
+    // the first window starts from the pattern of the whole window, but only
+    // keeps the candidates from the start of the scan
+    const unsigned int entry = (unsigned int)(start - window);
+    unsigned int phase = (unsigned int)((stride > 0 ? entry : WINDOW_BYTES - 1 - entry) % step);
+    uint32_t entryMask = stride > 0 ? ~(((uint32_t)1 << entry) - 1) : ((uint32_t)2 << entry) - 1;
+    if (stride > 0)
+    {
+        while (window < last)
+        {
+            if (!phaseShift && entryMask == WINDOW_MASK)
+            {
+                // steps dividing the window have the same candidates in every
+                // window, which are then searched four at a time
+                const uint32_t candidates = (pattern << phase) & WINDOW_MASK;
+                while (last - window > 4 * WINDOW_BYTES &&
+                       !((ZERO_MASK(bytes + window) | ZERO_MASK(bytes + window + WINDOW_BYTES) |
+                          ZERO_MASK(bytes + window + 2 * WINDOW_BYTES) | ZERO_MASK(bytes + window + 3 * WINDOW_BYTES)) &
+                         candidates))
+                {
+                    window += 4 * WINDOW_BYTES;
+                }
+            }
+            // the windows without candidates are skipped, for large steps
+            if (phase < WINDOW_BYTES)
+            {
+                uint32_t candidates = (pattern << phase) & WINDOW_MASK & entryMask;
+                if (last - window < WINDOW_BYTES)
+                {
+                    candidates &= ((uint32_t)1 << (last - window)) - 1;
+                }
+                const uint32_t hits = ZERO_MASK(bytes + window) & candidates;
+                if (hits)
+                {
+                    return (unsigned int)((window + __builtin_ctz(hits)) / CELL_BYTES);
+                }
+            }
+            window += WINDOW_BYTES;
+            entryMask = WINDOW_MASK;
+            phase = phase >= WINDOW_BYTES ? phase - WINDOW_BYTES : (phase >= phaseShift ? phase - phaseShift : phase + (unsigned int)step - phaseShift);
+        }
+    }
+    else
+    {
+        while (window + WINDOW_BYTES > first)
+        {
+            if (!phaseShift && entryMask == WINDOW_MASK)
+            {
+                const uint32_t candidates = pattern >> phase;
+                while (window - 3 * WINDOW_BYTES > first &&
+                       !((ZERO_MASK(bytes + window) | ZERO_MASK(bytes + window - WINDOW_BYTES) |
+                          ZERO_MASK(bytes + window - 2 * WINDOW_BYTES) | ZERO_MASK(bytes + window - 3 * WINDOW_BYTES)) &
+                         candidates))
+                {
+                    window -= 4 * WINDOW_BYTES;
+                }
+            }
+            if (phase < WINDOW_BYTES)
+            {
+                uint32_t candidates = (pattern >> phase) & entryMask;
+                if (first > window)
+                {
+                    candidates &= ~(((uint32_t)1 << (first - window)) - 1);
+                }
+                const uint32_t hits = ZERO_MASK(bytes + window) & candidates;
+                if (hits)
+                {
+                    return (unsigned int)((window + (31 - __builtin_clz(hits))) / CELL_BYTES);
+                }
+            }
+            window -= WINDOW_BYTES;
+            entryMask = WINDOW_MASK;
+            phase = phase >= WINDOW_BYTES ? phase - WINDOW_BYTES : (phase >= phaseShift ? phase - phaseShift : phase + (unsigned int)step - phaseShift);
+        }
+    }
+    return high;
+}
+
+#undef WINDOW_BYTES
+#undef WINDOW_MASK
+#undef KERNEL_TARGET
+#undef ZERO_MASK
+#undef KERNEL_NAME
+#undef KERNEL_AVX2
+#undef KERNEL_COMPARE
+#undef CELL_BYTES
+#undef CELL
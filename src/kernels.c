@@ -0,0 +1,130 @@
+//------------------------------------------------------------------------------
+// LIBRARIES
+//------------------------------------------------------------------------------
+
+#include <pthread.h>
+#include <stdint.h>
+#include "kernels.h"
+
+// SSE2 is part of x86-64, while AVX2 is only used when the processor has it
+#if defined(__x86_64__) && defined(__GNUC__)
+#include <immintrin.h>
+#define SIMD_KERNELS 1
+#else
+#define SIMD_KERNELS 0
+#endif
+
+//------------------------------------------------------------------------------
+// GLOBAL VARIABLES
+//------------------------------------------------------------------------------
+
+// Kernels of the 8, 16 and 32 bits cells, selected once for the processor
+static ScanKernel scanKernels[3];
+static pthread_once_t kernelsOnce = PTHREAD_ONCE_INIT;
+
+//------------------------------------------------------------------------------
+// FUNCTIONS
+//------------------------------------------------------------------------------
+
+#if SIMD_KERNELS
+
+#define KERNEL_NAME scanSse2Cells8
+#define KERNEL_COMPARE _mm_cmpeq_epi8
+#define CELL uint8_t
+#include "kernelTemplate.h"
+
+#define KERNEL_NAME scanSse2Cells16
+#define KERNEL_COMPARE _mm_cmpeq_epi16
+#define CELL uint16_t
+#include "kernelTemplate.h"
+
+#define KERNEL_NAME scanSse2Cells32
+#define KERNEL_COMPARE _mm_cmpeq_epi32
+#define CELL uint32_t
+#include "kernelTemplate.h"
+
+#define KERNEL_NAME scanAvx2Cells8
+#define KERNEL_AVX2
+#define KERNEL_COMPARE _mm256_cmpeq_epi8
+#define CELL uint8_t
+#include "kernelTemplate.h"
+
+#define KERNEL_NAME scanAvx2Cells16
+#define KERNEL_AVX2
+#define KERNEL_COMPARE _mm256_cmpeq_epi16
+#define CELL uint16_t
+#include "kernelTemplate.h"
+
+#define KERNEL_NAME scanAvx2Cells32
+#define KERNEL_AVX2
+#define KERNEL_COMPARE _mm256_cmpeq_epi32
+#define CELL uint32_t
+#include "kernelTemplate.h"
+
+#else
+
+// Portable kernel, which only reads the cells it steps on
+static inline unsigned int scanScalar(const void *const mem, const unsigned int index, const int stride, const unsigned int low, const unsigned int high, const unsigned int cellBytes)
+{
+    for (long long next = index; next >= low && next < high; next += stride)
+    {
+        const unsigned int value = cellBytes == 1 ? ((const uint8_t *)mem)[next] : (cellBytes == 2 ? ((const uint16_t *)mem)[next] : ((const uint32_t *)mem)[next]);
+        if (!value)
+        {
+            return (unsigned int)next;
+        }
+    }
+    return high;
+}
+
+static unsigned int scanScalarCells8(const void *const mem, const unsigned int index, const int stride, const unsigned int low, const unsigned int high)
+{
+    return scanScalar(mem, index, stride, low, high, 1);
+}
+
+static unsigned int scanScalarCells16(const void *const mem, const unsigned int index, const int stride, const unsigned int low, const unsigned int high)
+{
+    return scanScalar(mem, index, stride, low, high, 2);
+}
+
+static unsigned int scanScalarCells32(const void *const mem, const unsigned int index, const int stride, const unsigned int low, const unsigned int high)
+{
+    return scanScalar(mem, index, stride, low, high, 4);
+}
+
+#endif
+
+static void selectKernels(void)
+{
+#if SIMD_KERNELS
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+    {
+        scanKernels[0] = scanAvx2Cells8;
+        scanKernels[1] = scanAvx2Cells16;
+        scanKernels[2] = scanAvx2Cells32;
+    }
+    else
+    {
+        scanKernels[0] = scanSse2Cells8;
+        scanKernels[1] = scanSse2Cells16;
+        scanKernels[2] = scanSse2Cells32;
+    }
+#else
+    scanKernels[0] = scanScalarCells8;
+    scanKernels[1] = scanScalarCells16;
+    scanKernels[2] = scanScalarCells32;
+#endif
+}
+
+// Scan kernel of the given cell width, for the tapes aligned and padded to
+// TAPE_ALIGNMENT bytes
+ScanKernel scanKernel(const unsigned int cellBits)
+{
+    pthread_once(&kernelsOnce, selectKernels);
+    return scanKernels[cellBits / 16];
+}
+
+//------------------------------------------------------------------------------
+// END
+//------------------------------------------------------------------------------
@@ -0,0 +1,29 @@
+#ifndef __KERNELS
+#define __KERNELS
+
+//------------------------------------------------------------------------------
+// DEFINITIONS
+//------------------------------------------------------------------------------
+
+// Cells the engines step through one at a time before handing a scan over to
+// its kernel, whose setup only pays off on longer scans
+#define SCAN_INLINE_STEPS 8
+
+//------------------------------------------------------------------------------
+// USER TYPES
+//------------------------------------------------------------------------------
+
+// Searches the first zero cell from index, in steps of stride, among the cells
+// [low, high) of the tape. Returns its index, or high if there is none.
+typedef unsigned int (*ScanKernel)(const void *mem, unsigned int index, int stride, unsigned int low, unsigned int high);
+
+//------------------------------------------------------------------------------
+// FUNCTION PROTOTYPES
+//------------------------------------------------------------------------------
+
+ScanKernel scanKernel(const unsigned int cellBits);
+
+//------------------------------------------------------------------------------
+// END
+//------------------------------------------------------------------------------
+#endif // __KERNELS
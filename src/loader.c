@@ -0,0 +1,143 @@
+//------------------------------------------------------------------------------
+// LIBRARIES
+//------------------------------------------------------------------------------
+
+#define _DEFAULT_SOURCE // MADV_SEQUENTIAL
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "loader.h"
+#include "parser.h"
+#include "cache.h"
+
+//------------------------------------------------------------------------------
+// DEFINITIONS
+//------------------------------------------------------------------------------
+
+#define CHUNK_SIZE (64 * 1024)
+
+//------------------------------------------------------------------------------
+// FUNCTIONS
+//------------------------------------------------------------------------------
+
+static void fileError(const char *const fileName)
+{
+    fprintf(stderr, "\n[Error]: Couldn't read the file %s: %s\n", fileName, strerror(errno));
+}
+
+// Regular files are mapped in memory and compiled in place, so the source
+// code is never copied and stays available for the error messages. With a
+// cache that has the program of this source, it is only hashed, not compiled.
+static struct Program *loadMappedFile(const int fd, const size_t length, const int debugCommands, const struct CacheOptions *const cache)
+{
+    if (!length)
+    {
+        return compileProgram("", 0, debugCommands);
+    }
+    void *source = mmap(NULL, length, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (source == MAP_FAILED)
+    {
+        return NULL;
+    }
+    madvise(source, length, MADV_SEQUENTIAL);
+    struct Program *program = cache ? readCache(cache, (const char *)source, length) : NULL;
+    if (program)
+    {
+        return program;
+    }
+    program = compileProgram((const char *)source, length, debugCommands);
+    if (!program)
+    {
+        munmap(source, length);
+        // the error was already reported
+        errno = 0;
+    }
+    return program;
+}
+
+// Pipes and other streams are compiled one chunk at a time, so the memory
+// used doesn't depend on the size of the source code, which is not kept
+static struct Program *loadStream(const int fd, const int debugCommands)
+{
+    char *chunk = (char *)malloc(CHUNK_SIZE);
+    struct Program *program = newProgram(NULL, 0, debugCommands);
+    if (!chunk || !program)
+    {
+        free((void *)chunk);
+        freeProgram(program);
+        return NULL;
+    }
+    for (;;)
+    {
+        const ssize_t length = read(fd, chunk, CHUNK_SIZE);
+        if (length < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (length < 0 || (length && compileBrainFuck(program, chunk, length)))
+        {
+            free((void *)chunk);
+            freeProgram(program);
+            return NULL;
+        }
+        if (!length)
+        {
+            break;
+        }
+    }
+    free((void *)chunk);
+    if (finishBrainFuck(program))
+    {
+        freeProgram(program);
+        // the error was already reported
+        errno = 0;
+        return NULL;
+    }
+    return program;
+}
+
+// Loads the program from a file, or from the standard input if the name is -.
+// The debug commands are only compiled in debug mode, otherwise they are comments.
+// Streams are never found in the cache, which is keyed by the whole source.
+struct Program *loadProgram(const char *const fileName, const int debugCommands, const struct CacheOptions *const cache)
+{
+    const int useStdin = !strcmp(fileName, "-");
+    const int fd = useStdin ? STDIN_FILENO : open(fileName, O_RDONLY);
+    struct stat st;
+    struct Program *program = NULL;
+    if (fd >= 0 && !fstat(fd, &st))
+    {
+        program = S_ISREG(st.st_mode) ? loadMappedFile(fd, st.st_size, debugCommands, cache) : loadStream(fd, debugCommands);
+    }
+    if (!program && errno)
+    {
+        fileError(fileName);
+    }
+    if (fd >= 0 && !useStdin)
+    {
+        close(fd);
+    }
+    return program;
+}
+
+void unloadProgram(struct Program *const program)
+{
+    if (program)
+    {
+        if (program->sourceLength)
+        {
+            munmap((void *)program->source, program->sourceLength);
+        }
+        freeProgram(program);
+    }
+}
+
+//------------------------------------------------------------------------------
+// END
+//------------------------------------------------------------------------------
@@ -0,0 +1,21 @@
+#ifndef __LOADER
+#define __LOADER
+
+//------------------------------------------------------------------------------
+// LIBRARIES
+//------------------------------------------------------------------------------
+
+#include "program.h"
+#include "cache.h"
+
+//------------------------------------------------------------------------------
+// FUNCTION PROTOTYPES
+//------------------------------------------------------------------------------
+
+struct Program *loadProgram(const char *const fileName, const int debugCommands, const struct CacheOptions *const cache);
+void unloadProgram(struct Program *const program);
+
+//------------------------------------------------------------------------------
+// END
+//------------------------------------------------------------------------------
+#endif // __LOADER
@@ -1,187 +1,1002 @@
-//------------------------------------------------------------------------------
-// LIBRARIES
-//------------------------------------------------------------------------------
-
-#include <stdio.h>
-#include <stdlib.h>
-#include <string.h>
-#include <sys/stat.h>
-#include <termios.h> // termios, TCSANOW, ECHO, ICANON
-#include <unistd.h>  // STDIN_FILENO
-#include <errno.h>
-#include "arguments.h"
-#include "parser.h"
-
-//------------------------------------------------------------------------------
-// USER TYPES
-//------------------------------------------------------------------------------
-
-enum ActionToBeTaken
-{
-    acNone = 0,
-    acParser,
-};
-
-//------------------------------------------------------------------------------
-// GLOBAL VARIABLES
-//------------------------------------------------------------------------------
-
-static const char *const version = "1.0.0";
-static const char *fileName = NULL;
-static enum ActionToBeTaken action = acParser;
-static struct termios oldt, newt;
-
-//------------------------------------------------------------------------------
-// FUNCTIONS
-//------------------------------------------------------------------------------
-
-char *getContentFromFile(const char *const filename)
-{
-    char *buffer = NULL;
-    // Get file size
-    struct stat st;
-    if (!stat(filename, &st))
-    {
-        const size_t fileSize = st.st_size;
-        // Open file
-        FILE *file = fopen(filename, "rb");
-        if (file)
-        {
-            // Allocate memory to store the entire file
-            buffer = (char *)malloc((fileSize + 1) * sizeof(char));
-            if (buffer)
-            {
-                // Copy the contents of the file to the buffer
-                const size_t result = fread(buffer, sizeof(char), fileSize, file);
-                buffer[fileSize] = '\0';
-                if (ferror(file) || result != fileSize)
-                {
-                    // Reading file error, free dinamically allocated memory
-                    free(buffer);
-                    buffer = NULL;
-                }
-            }
-            fclose(file);
-        }
-    }
-    return buffer;
-}
-
-static int printUsage(const char *const software)
-{
-    printf("[Usage] %s [script.b] [Options]\n", software);
-    action = acNone;
-    return EXIT_SUCCESS;
-}
-
-static int getFileName(const char *const arg)
-{
-    if (fileName)
-    {
-        return EXIT_FAILURE;
-    }
-    else
-    {
-        fileName = arg;
-    }
-    return EXIT_SUCCESS;
-}
-
-static int printVersion(const char *const arg)
-{
-    (void)arg;
-    printf("[Version] %s\n", version);
-    action = acNone;
-    return EXIT_SUCCESS;
-}
-
-static int debugModeOn(const char *const arg)
-{
-    (void)arg;
-    printf("Debug mode on.\n");
-    debugMode = 1;
-    return EXIT_SUCCESS;
-}
-
-static int printLanguageInstructions(const char *const arg)
-{
-    (void)arg;
-    printInstructions();
-    action = acNone;
-    return EXIT_SUCCESS;
-}
-
-static int changeMemorySize(const char *const arg)
-{
-    unsigned int size;
-    const char *ptr = strchr(arg, '=');
-    size = atoi(++ptr);
-    if (size > 10)
-    {
-        printf("Program buffer size changed to %u elements.\n", size);
-        memorySize = size;
-    }
-    return EXIT_SUCCESS;
-}
-
-void restoreTerminalSettings(void)
-{
-    tcsetattr(STDIN_FILENO, TCSANOW, &oldt);
-}
-
-void changeTerminalSettings(void)
-{
-    // gets the parameters of the current terminal
-    tcgetattr(STDIN_FILENO, &oldt);
-    newt = oldt;
-    /* ICANON normally takes care that one line at a time will be processed
-       that means it will return if it sees a "\n" or an EOF or an EOL */
-    newt.c_lflag &= ~(ICANON);
-    /* Those new settings will be set to STDIN
-       TCSANOW tells tcsetattr to change attributes immediately. */
-    tcsetattr(STDIN_FILENO, TCSANOW, &newt);
-    atexit(restoreTerminalSettings);
-}
-
-//------------------------------------------------------------------------------
-// MAIN
-//------------------------------------------------------------------------------
-
-int main(const int argc, const char *const argv[])
-{
-    const char *prog;
-    changeTerminalSettings();
-    // parse command line arguments
-    initBrainFuck();
-    initArguments(printUsage, getFileName);
-    addArgument("--version", "-v", printVersion, "Display the software version.");
-    addArgument("--debug", "-d", debugModeOn, "Activate the debug mode (allows the use of the commands # and @).");
-    addArgument("--language", "-l", printLanguageInstructions, "Displays language instructions.");
-    addArgument("--memory=%d", "-m=%d", changeMemorySize, "Change program buffer size.");
-    parseArguments(argc, argv);
-    if (action == acNone)
-    {
-        return EXIT_SUCCESS;
-    }
-    if (!fileName)
-    {
-        argumentsUsage("No file specified");
-        return EXIT_FAILURE;
-    }
-    prog = getContentFromFile(fileName);
-    if (prog)
-    {
-        brainFuck(prog);
-        free((char *)prog);
-    }
-    else
-    {
-        fprintf(stderr, "\n[Error]: Couldn't read the file %s: %s\n", fileName, strerror(errno));
-        return EXIT_FAILURE;
-    }
-    return EXIT_SUCCESS;
-}
-
-//------------------------------------------------------------------------------
-// END
-//------------------------------------------------------------------------------
+//------------------------------------------------------------------------------
+// LIBRARIES
+//------------------------------------------------------------------------------
+
+#define _DEFAULT_SOURCE // setitimer, sigaction
+
+#include <limits.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#include <termios.h> // termios, TCSANOW, ECHO, ICANON
+#include <unistd.h>  // STDIN_FILENO
+#include <errno.h>
+#include "arguments.h"
+#include "batch.h"
+#include "checker.h"
+#include "parser.h"
+#include "emitter.h"
+#include "io.h"
+#include "loader.h"
+#include "prefix.h"
+#include "cache.h"
+#include "brainfuck.h"
+
+//------------------------------------------------------------------------------
+// DEFINITIONS
+//------------------------------------------------------------------------------
+
+// Exit status of the runs stopped by --max-steps, --timeout and --max-output
+#define EXIT_STEP_LIMIT 3
+#define EXIT_TIME_LIMIT 4
+#define EXIT_OUTPUT_LIMIT 5
+
+// Default loop iterations the program may run at load time, before its first
+// input, and output it may write then
+#define PREFIX_STEPS (1ull << 24)
+#define PREFIX_OUTPUT_BYTES (16ull * 1024 * 1024)
+
+//------------------------------------------------------------------------------
+// USER TYPES
+//------------------------------------------------------------------------------
+
+enum ActionToBeTaken
+{
+    acNone = 0,
+    acParser,
+    acEmitC,
+    acBatch,
+    acCheck,
+    acDecodeTrace,
+};
+
+enum OutputMode
+{
+    outputAuto = 0,
+    outputLine,
+    outputFull,
+};
+
+enum InputMode
+{
+    inputAuto = 0,
+    inputInteractive,
+    inputStream,
+};
+
+//------------------------------------------------------------------------------
+// GLOBAL VARIABLES
+//------------------------------------------------------------------------------
+
+static const char *const version = "1.0.0";
+static const char *fileName = NULL;
+static const char *outputFileName = NULL;
+static enum ActionToBeTaken action = acParser;
+static struct termios oldt, newt;
+static struct Options options;
+static enum OutputMode outputMode = outputAuto;
+static enum InputMode inputMode = inputAuto;
+// set by --eof, otherwise the end of the input depends on the input mode
+static int eofChosen = 0;
+static const char *batchListName = NULL;
+static unsigned int threadNum = 0;
+static enum BatchOutput batchOutput = batchStream;
+static struct Budget budget;
+static double timeoutSeconds = 0.0;
+static const char *snapshotFileName = NULL;
+static double snapshotSeconds = 60.0;
+static int snapshotIncremental = 0;
+static const char *resumeFileName = NULL;
+static unsigned long long prefixSteps = PREFIX_STEPS;
+static const char *cacheDirectory = NULL;
+static const char *traceFileName = NULL;
+static struct TraceFilter traceFilter;
+// stopped by the signal handlers
+static struct Environment *volatile runningEnvironment = NULL;
+static volatile sig_atomic_t timeoutExpired = 0;
+static volatile sig_atomic_t terminationSignal = 0;
+
+//------------------------------------------------------------------------------
+// FUNCTIONS
+//------------------------------------------------------------------------------
+
+static int printUsage(const char *const software)
+{
+    printf("[Usage] %s [script.b] [Options]\n", software);
+    action = acNone;
+    return EXIT_SUCCESS;
+}
+
+static int getFileName(const char *const arg)
+{
+    if (fileName)
+    {
+        return EXIT_FAILURE;
+    }
+    else
+    {
+        fileName = arg;
+    }
+    return EXIT_SUCCESS;
+}
+
+static int printVersion(const char *const arg)
+{
+    (void)arg;
+    printf("[Version] %s\n", version);
+    action = acNone;
+    return EXIT_SUCCESS;
+}
+
+static int debugModeOn(const char *const arg)
+{
+    (void)arg;
+    printf("Debug mode on.\n");
+    options.debugMode = 1;
+    return EXIT_SUCCESS;
+}
+
+static int profileModeOn(const char *const arg)
+{
+    (void)arg;
+    options.profileMode = 1;
+    return EXIT_SUCCESS;
+}
+
+static int printLanguageInstructions(const char *const arg)
+{
+    (void)arg;
+    printInstructions();
+    action = acNone;
+    return EXIT_SUCCESS;
+}
+
+static int changeMemorySize(const char *const arg)
+{
+    unsigned int size;
+    const char *ptr = strchr(arg, '=');
+    size = atoi(++ptr);
+    if (size > 10)
+    {
+        printf("Program buffer size changed to %u elements.\n", size);
+        options.memorySize = size;
+    }
+    return EXIT_SUCCESS;
+}
+
+static int changeCellBits(const char *const arg)
+{
+    const char *ptr = strchr(arg, '=');
+    const int bits = atoi(++ptr);
+    if (bits != 8 && bits != 16 && bits != 32)
+    {
+        fprintf(stderr, "[Error]: Unsupported cell width: %s\n", ptr);
+        action = acNone;
+        return EXIT_FAILURE;
+    }
+    options.cellBits = bits;
+    return EXIT_SUCCESS;
+}
+
+static int changeTapeMode(const char *const arg)
+{
+    const char *ptr = strchr(arg, '=');
+    ptr++;
+    if (!strcmp(ptr, "fixed"))
+    {
+        options.tapeMode = tapeFixed;
+    }
+    else if (!strcmp(ptr, "unbounded"))
+    {
+        options.tapeMode = tapeUnbounded;
+    }
+    else if (!strcmp(ptr, "sparse"))
+    {
+        options.tapeMode = tapeSparse;
+    }
+    else
+    {
+        fprintf(stderr, "[Error]: Unknown tape: %s\n", ptr);
+        action = acNone;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
+
+static int changeEngine(const char *const arg)
+{
+    const char *ptr = strchr(arg, '=');
+    ptr++;
+    if (!strcmp(ptr, "reference"))
+    {
+        options.engine = engineReference;
+    }
+    else if (!strcmp(ptr, "switch"))
+    {
+        options.engine = engineSwitch;
+    }
+    else if (!strcmp(ptr, "threaded"))
+    {
+        options.engine = engineThreaded;
+    }
+    else if (!strcmp(ptr, "jit"))
+    {
+        options.engine = engineJit;
+    }
+    else
+    {
+        fprintf(stderr, "[Error]: Unknown engine: %s\n", ptr);
+        action = acNone;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
+
+static int jitModeOn(const char *const arg)
+{
+    (void)arg;
+    options.engine = engineJit;
+    return EXIT_SUCCESS;
+}
+
+static int emitCOn(const char *const arg)
+{
+    const char *ptr = strchr(arg, '=');
+    outputFileName = ++ptr;
+    action = acEmitC;
+    return EXIT_SUCCESS;
+}
+
+static int checkOn(const char *const arg)
+{
+    (void)arg;
+    action = acCheck;
+    return EXIT_SUCCESS;
+}
+
+static int emitCFile(const struct Program *const program)
+{
+    FILE *file = fopen(outputFileName, "w");
+    if (!file)
+    {
+        fprintf(stderr, "\n[Error]: Couldn't create the file %s: %s\n", outputFileName, strerror(errno));
+        return EXIT_FAILURE;
+    }
+    // the translation only prompts for keys if explicitly asked to
+    int result = emitC(program, file, fileName, &options, inputMode == inputInteractive);
+    if (fclose(file) || result)
+    {
+        fprintf(stderr, "\n[Error]: Couldn't write the file %s: %s\n", outputFileName, strerror(errno));
+        result = EXIT_FAILURE;
+    }
+    return result;
+}
+
+static int batchOn(const char *const arg)
+{
+    const char *ptr = strchr(arg, '=');
+    batchListName = ++ptr;
+    action = acBatch;
+    return EXIT_SUCCESS;
+}
+
+static int changeThreadNum(const char *const arg)
+{
+    const char *ptr = strchr(arg, '=');
+    const int threads = atoi(++ptr);
+    if (threads < 1)
+    {
+        fprintf(stderr, "[Error]: Invalid number of threads: %s\n", ptr);
+        action = acNone;
+        return EXIT_FAILURE;
+    }
+    threadNum = threads;
+    return EXIT_SUCCESS;
+}
+
+static int changeBatchOutput(const char *const arg)
+{
+    const char *ptr = strchr(arg, '=');
+    ptr++;
+    if (!strcmp(ptr, "stream"))
+    {
+        batchOutput = batchStream;
+    }
+    else if (!strcmp(ptr, "files"))
+    {
+        batchOutput = batchFiles;
+    }
+    else
+    {
+        fprintf(stderr, "[Error]: Unknown batch output: %s\n", ptr);
+        action = acNone;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
+
+static int changeMaxSteps(const char *const arg)
+{
+    const char *ptr = strchr(arg, '=');
+    char *end;
+    budget.steps = strtoull(++ptr, &end, 10);
+    if (*end || !budget.steps)
+    {
+        fprintf(stderr, "[Error]: Invalid number of steps: %s\n", ptr);
+        action = acNone;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
+
+static int changePrefixSteps(const char *const arg)
+{
+    const char *ptr = strchr(arg, '=');
+    char *end;
+    prefixSteps = strtoull(++ptr, &end, 10);
+    if (*end || *ptr == '-')
+    {
+        fprintf(stderr, "[Error]: Invalid number of steps: %s\n", ptr);
+        action = acNone;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
+
+static int changeCacheDirectory(const char *const arg)
+{
+    const char *ptr = strchr(arg, '=');
+    cacheDirectory = ++ptr;
+    if (!*cacheDirectory)
+    {
+        fprintf(stderr, "[Error]: Invalid cache directory\n");
+        action = acNone;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
+
+static int changeTimeout(const char *const arg)
+{
+    const char *ptr = strchr(arg, '=');
+    char *end;
+    timeoutSeconds = strtod(++ptr, &end);
+    if (*end || !(timeoutSeconds > 0.0) || timeoutSeconds > 1e9)
+    {
+        fprintf(stderr, "[Error]: Invalid timeout: %s\n", ptr);
+        action = acNone;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
+
+static int changeMaxOutput(const char *const arg)
+{
+    const char *ptr = strchr(arg, '=');
+    char *end;
+    budget.outputBytes = strtoull(++ptr, &end, 10);
+    if (*end || !budget.outputBytes)
+    {
+        fprintf(stderr, "[Error]: Invalid output size: %s\n", ptr);
+        action = acNone;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
+
+static int snapshotOn(const char *const arg)
+{
+    const char *ptr = strchr(arg, '=');
+    snapshotFileName = ++ptr;
+    options.snapshotMode = 1;
+    return EXIT_SUCCESS;
+}
+
+static int changeSnapshotInterval(const char *const arg)
+{
+    const char *ptr = strchr(arg, '=');
+    char *end;
+    snapshotSeconds = strtod(++ptr, &end);
+    if (*end || !(snapshotSeconds >= 1e-3) || snapshotSeconds > 1e9)
+    {
+        fprintf(stderr, "[Error]: Invalid snapshot interval: %s\n", ptr);
+        action = acNone;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
+
+static int snapshotIncrementalOn(const char *const arg)
+{
+    (void)arg;
+    snapshotIncremental = 1;
+    return EXIT_SUCCESS;
+}
+
+static int resumeOn(const char *const arg)
+{
+    const char *ptr = strchr(arg, '=');
+    resumeFileName = ++ptr;
+    return EXIT_SUCCESS;
+}
+
+static int traceOn(const char *const arg)
+{
+    const char *ptr = strchr(arg, '=');
+    traceFileName = ++ptr;
+    return EXIT_SUCCESS;
+}
+
+// Reads "first-last", where either number may be left out
+static int parseRange(const char *const text, unsigned long long *const first, unsigned long long *const last)
+{
+    const char *ptr = text;
+    char *end;
+    *first = 0;
+    *last = 0;
+    if (*ptr >= '0' && *ptr <= '9')
+    {
+        *first = strtoull(ptr, &end, 10);
+        ptr = end;
+    }
+    if (*ptr++ != '-')
+    {
+        return EXIT_FAILURE;
+    }
+    if (*ptr >= '0' && *ptr <= '9')
+    {
+        *last = strtoull(ptr, &end, 10);
+        ptr = end;
+    }
+    return (*ptr || (*last && *last < *first)) ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+static int changeTraceLines(const char *const arg)
+{
+    const char *ptr = strchr(arg, '=');
+    unsigned long long first, last;
+    if (parseRange(++ptr, &first, &last) || last > UINT_MAX || first > UINT_MAX)
+    {
+        fprintf(stderr, "[Error]: Invalid range of lines: %s\n", ptr);
+        action = acNone;
+        return EXIT_FAILURE;
+    }
+    traceFilter.firstLine = (unsigned int)first;
+    traceFilter.lastLine = (unsigned int)last;
+    return EXIT_SUCCESS;
+}
+
+static int changeTraceSteps(const char *const arg)
+{
+    const char *ptr = strchr(arg, '=');
+    if (parseRange(++ptr, &traceFilter.firstStep, &traceFilter.lastStep))
+    {
+        fprintf(stderr, "[Error]: Invalid range of steps: %s\n", ptr);
+        action = acNone;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
+
+static int decodeTraceOn(const char *const arg)
+{
+    const char *ptr = strchr(arg, '=');
+    traceFileName = ++ptr;
+    action = acDecodeTrace;
+    return EXIT_SUCCESS;
+}
+
+static int printTraceFile(const struct Program *const program)
+{
+    const char *const msg = printTrace(program, traceFileName);
+    if (msg)
+    {
+        fprintf(stderr, "\n[Error]: Couldn't decode the trace %s: %s\n", traceFileName, msg);
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
+
+static int changeOutputMode(const char *const arg)
+{
+    const char *ptr = strchr(arg, '=');
+    ptr++;
+    if (!strcmp(ptr, "line"))
+    {
+        outputMode = outputLine;
+    }
+    else if (!strcmp(ptr, "full"))
+    {
+        outputMode = outputFull;
+    }
+    else
+    {
+        fprintf(stderr, "[Error]: Unknown output buffering mode: %s\n", ptr);
+        action = acNone;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
+
+static int changeInputMode(const char *const arg)
+{
+    const char *ptr = strchr(arg, '=');
+    ptr++;
+    if (!strcmp(ptr, "interactive"))
+    {
+        inputMode = inputInteractive;
+    }
+    else if (!strcmp(ptr, "stream"))
+    {
+        inputMode = inputStream;
+    }
+    else
+    {
+        fprintf(stderr, "[Error]: Unknown input mode: %s\n", ptr);
+        action = acNone;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
+
+static int changeEofMode(const char *const arg)
+{
+    const char *ptr = strchr(arg, '=');
+    ptr++;
+    if (!strcmp(ptr, "-1"))
+    {
+        options.eofMode = eofMinusOne;
+    }
+    else if (!strcmp(ptr, "0"))
+    {
+        options.eofMode = eofZero;
+    }
+    else if (!strcmp(ptr, "unchanged"))
+    {
+        options.eofMode = eofUnchanged;
+    }
+    else
+    {
+        fprintf(stderr, "[Error]: Unknown end of input mode: %s\n", ptr);
+        action = acNone;
+        return EXIT_FAILURE;
+    }
+    eofChosen = 1;
+    return EXIT_SUCCESS;
+}
+
+// Keys are asked if requested, or by default on terminals. The inputs of the
+// batch are files, and the C translation only asks for keys if requested.
+static int interactiveInput(void)
+{
+    if (action == acBatch || action == acEmitC)
+    {
+        return inputMode == inputInteractive;
+    }
+    return (inputMode == inputInteractive) || (inputMode == inputAuto && isatty(STDIN_FILENO));
+}
+
+void restoreTerminalSettings(void)
+{
+    tcsetattr(STDIN_FILENO, TCSANOW, &oldt);
+}
+
+void changeTerminalSettings(void)
+{
+    // gets the parameters of the current terminal
+    tcgetattr(STDIN_FILENO, &oldt);
+    newt = oldt;
+    /* ICANON normally takes care that one line at a time will be processed
+       that means it will return if it sees a "\n" or an EOF or an EOL */
+    newt.c_lflag &= ~(ICANON);
+    /* Those new settings will be set to STDIN
+       TCSANOW tells tcsetattr to change attributes immediately. */
+    tcsetattr(STDIN_FILENO, TCSANOW, &newt);
+    atexit(restoreTerminalSettings);
+}
+
+static void timeoutHandler(const int signal)
+{
+    (void)signal;
+    timeoutExpired = 1;
+    if (runningEnvironment)
+    {
+        stopEnvironment(runningEnvironment, stopTime);
+    }
+}
+
+// The program is stopped to save its snapshot, and a second signal ends the
+// interpreter at once
+static void terminationHandler(const int signal)
+{
+    if (terminationSignal)
+    {
+        sigaction(signal, &(struct sigaction){.sa_handler = SIG_DFL}, NULL);
+        raise(signal);
+        return;
+    }
+    terminationSignal = signal;
+    if (runningEnvironment)
+    {
+        interruptEnvironment(runningEnvironment);
+    }
+}
+
+static void installHandler(const int signal, void (*const handler)(int))
+{
+    struct sigaction action;
+    action.sa_handler = handler;
+    action.sa_flags = SA_RESTART;
+    sigemptyset(&action.sa_mask);
+    sigaction(signal, &action, NULL);
+}
+
+// The engines only look at the request of the handler when they check their
+// budget, so the time limit costs nothing while the program runs
+static void startTimeout(void)
+{
+    installHandler(SIGALRM, timeoutHandler);
+    // a zero timer would be disarmed
+    const long long microseconds = timeoutSeconds < 1e-6 ? 1 : (long long)(timeoutSeconds * 1e6);
+    const struct itimerval timer = {
+        .it_interval = {.tv_sec = 0, .tv_usec = 0},
+        .it_value = {.tv_sec = microseconds / 1000000, .tv_usec = microseconds % 1000000},
+    };
+    setitimer(ITIMER_REAL, &timer, NULL);
+}
+
+static void stopTimeout(void)
+{
+    const struct itimerval timer = {
+        .it_interval = {.tv_sec = 0, .tv_usec = 0},
+        .it_value = {.tv_sec = 0, .tv_usec = 0},
+    };
+    setitimer(ITIMER_REAL, &timer, NULL);
+}
+
+static int stopExitStatus(const enum StopReason reason)
+{
+    switch (reason)
+    {
+    case stopSteps:
+        return EXIT_STEP_LIMIT;
+    case stopTime:
+        return EXIT_TIME_LIMIT;
+    case stopOutput:
+        return EXIT_OUTPUT_LIMIT;
+    default:
+        return EXIT_FAILURE;
+    }
+}
+
+// The limits count from the start of the program, snapshots included, and
+// the runs stop for the next snapshot. Returns the limit already reached.
+static enum StopReason nextBudget(const struct Environment *const env, struct Budget *const next)
+{
+    struct Usage usage;
+    environmentUsage(env, &usage);
+    *next = (struct Budget){.steps = 0, .milliseconds = 0, .outputBytes = 0};
+    if (budget.steps)
+    {
+        if (usage.steps >= budget.steps)
+        {
+            return stopSteps;
+        }
+        next->steps = budget.steps - usage.steps;
+    }
+    if (budget.outputBytes)
+    {
+        if (usage.outputBytes >= budget.outputBytes)
+        {
+            return stopOutput;
+        }
+        next->outputBytes = budget.outputBytes - usage.outputBytes;
+    }
+    if (snapshotFileName)
+    {
+        next->milliseconds = (unsigned long long)(snapshotSeconds * 1000);
+    }
+    return stopNone;
+}
+
+static int saveSnapshot(struct Environment *const env)
+{
+    const char *const msg = saveEnvironment(env, snapshotFileName, snapshotIncremental);
+    if (msg)
+    {
+        fprintf(stderr, "\n[Error]: Couldn't save the snapshot %s: %s\n", snapshotFileName, msg);
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
+
+// Runs the program until it ends, fails or reaches a limit, saving its
+// snapshot every snapshotSeconds and when it stops
+static enum RunStatus runUntilStopped(struct Environment *const env, enum StopReason *const reason)
+{
+    for (;;)
+    {
+        struct Budget next;
+        *reason = nextBudget(env, &next);
+        if (*reason != stopNone)
+        {
+            // reached before the snapshot the program resumes from
+            fprintf(stderr, "\n[Stopped]: %s\n", stopMessage(*reason));
+            return runStopped;
+        }
+        const enum RunStatus status = runEnvironment(env, &next);
+        if (status != runStopped)
+        {
+            return status;
+        }
+        *reason = environmentStop(env, NULL, NULL);
+        if (snapshotFileName)
+        {
+            saveSnapshot(env);
+        }
+        if (!snapshotFileName || *reason != stopTime || timeoutExpired)
+        {
+            printEnvironmentStop(env);
+            if (snapshotFileName)
+            {
+                fprintf(stderr, "\n[Snapshot]: The program continues with --resume=%s\n", snapshotFileName);
+            }
+            return status;
+        }
+    }
+}
+
+// Budget of the start of the program that doesn't read the input, run at
+// load time, or no steps if it isn't. The time taken there would escape the
+// timeout, and the profiler, the trace and the snapshots resumed need the
+// whole run.
+static void getPrefixBudget(struct Budget *const prefixBudget)
+{
+    *prefixBudget = (struct Budget){.steps = prefixSteps, .milliseconds = 0, .outputBytes = PREFIX_OUTPUT_BYTES};
+    if (timeoutSeconds > 0.0 || options.profileMode || traceFileName || resumeFileName)
+    {
+        prefixBudget->steps = 0;
+    }
+    // below the limits, so the runs stop where they would without the prefix
+    if (budget.steps && budget.steps <= prefixBudget->steps)
+    {
+        prefixBudget->steps = budget.steps - 1;
+    }
+    if (budget.outputBytes && budget.outputBytes < prefixBudget->outputBytes)
+    {
+        prefixBudget->outputBytes = budget.outputBytes;
+    }
+    if (!prefixBudget->steps)
+    {
+        prefixBudget->outputBytes = 0;
+    }
+}
+
+// Runs the prefix of a program that doesn't come from the cache, so the runs,
+// and every input of --batch, continue from its state, then stores it in the
+// cache. A program that can't be cached simply runs from its start.
+static void completeProgram(struct Program *const program, const struct CacheOptions *const cache)
+{
+    if (program->cache)
+    {
+        return;
+    }
+    struct Budget prefixBudget;
+    getPrefixBudget(&prefixBudget);
+    if (prefixBudget.steps)
+    {
+        evaluatePrefix(program, &options, &prefixBudget);
+    }
+    if (cache)
+    {
+        writeCache(cache, program);
+    }
+}
+
+static int runProgram(const struct Program *const program)
+{
+    struct Io io = {
+        .read = readStandardInput,
+        .write = writeStandardOutput,
+        .writev = writevStandardOutput,
+        .user = NULL,
+        .lineBuffered = (outputMode == outputLine) || (outputMode == outputAuto && isatty(STDOUT_FILENO)),
+    };
+    if (interactiveInput())
+    {
+        // keys are read one at a time, without waiting for a newline
+        io.read = askStandardInput;
+        changeTerminalSettings();
+    }
+    struct Environment *env = newEnvironment(program, &options, &io);
+    if (!env)
+    {
+        fprintf(stderr, "\n[Error]: Couldn't allocate the program memory\n");
+        return EXIT_FAILURE;
+    }
+    const char *const msg = resumeFileName ? restoreEnvironment(env, resumeFileName) : NULL;
+    if (msg)
+    {
+        fprintf(stderr, "\n[Error]: Couldn't resume from %s: %s\n", resumeFileName, msg);
+        freeEnvironment(env);
+        return EXIT_FAILURE;
+    }
+    const char *const traceMsg = traceFileName ? traceEnvironment(env, traceFileName, &traceFilter) : NULL;
+    if (traceMsg)
+    {
+        fprintf(stderr, "\n[Error]: Couldn't create the trace %s: %s\n", traceFileName, traceMsg);
+        freeEnvironment(env);
+        return EXIT_FAILURE;
+    }
+    runningEnvironment = env;
+    if (snapshotFileName)
+    {
+        installHandler(SIGINT, terminationHandler);
+        installHandler(SIGTERM, terminationHandler);
+    }
+    if (timeoutSeconds > 0.0)
+    {
+        startTimeout();
+    }
+    enum StopReason reason = stopNone;
+    const enum RunStatus status = runUntilStopped(env, &reason);
+    stopTimeout();
+    runningEnvironment = NULL;
+    int result = EXIT_SUCCESS;
+    if (status == runError)
+    {
+        printEnvironmentError(env);
+    }
+    else if (status == runStopped)
+    {
+        result = terminationSignal ? 128 + terminationSignal : stopExitStatus(reason);
+    }
+    printEnvironmentProfile(env);
+    const char *const writeMsg = traceEnvironment(env, NULL, NULL);
+    if (writeMsg)
+    {
+        fprintf(stderr, "\n[Error]: Couldn't write the trace %s: %s\n", traceFileName, writeMsg);
+        result = EXIT_FAILURE;
+    }
+    freeEnvironment(env);
+    return result;
+}
+
+//------------------------------------------------------------------------------
+// MAIN
+//------------------------------------------------------------------------------
+
+int main(const int argc, const char *const argv[])
+{
+    struct Program *program;
+    // parse command line arguments
+    defaultOptions(&options);
+    initArguments(printUsage, getFileName);
+    addArgument("--version", "-v", printVersion, "Display the software version.");
+    addArgument("--debug", "-d", debugModeOn, "Activate the debug mode (allows the use of the commands # and @).");
+    addArgument("--profile", "-p", profileModeOn, "Count how often each instruction and loop runs, and print the hot spots at the end.");
+    addArgument("--language", "-l", printLanguageInstructions, "Displays language instructions.");
+    addArgument("--memory=%d", "-m=%d", changeMemorySize, "Change program buffer size.");
+    addArgument("--cell-bits=%d", "-b=%d", changeCellBits, "Width of the memory cells, which wrap around: 8 (default), 16 or 32 bits.");
+    addArgument("--tape=%s", "-t=%s", changeTapeMode, "Memory of the program: fixed (default, see --memory), sparse (same size, allocated when written) or unbounded in both directions.");
+    addArgument("--engine=%s", "-e=%s", changeEngine, "Select the execution engine: reference, switch, threaded (default) or jit.");
+    addArgument("--jit", "-j", jitModeOn, "Translate the program to native code before running it (same as --engine=jit).");
+    addArgument("--max-steps=%d", NULL, changeMaxSteps, "Stop the program after this number of loop iterations (exit status 3).");
+    addArgument("--timeout=%f", NULL, changeTimeout, "Stop the program after this number of seconds (exit status 4).");
+    addArgument("--prefix-steps=%d", NULL, changePrefixSteps, "Loop iterations the program may run at load time, before it reads its input (default is 16777216, 0 disables it).");
+    addArgument("--cache-dir=%s", NULL, changeCacheDirectory, "Keep the compiled programs, with their prefix, in the given directory, and map them from there instead of compiling them again.");
+    addArgument("--max-output=%d", NULL, changeMaxOutput, "Stop the program when it writes more than this number of bytes (exit status 5).");
+    addArgument("--snapshot=%s", NULL, snapshotOn, "Save the state of the program to the given file periodically and when it stops.");
+    addArgument("--snapshot-interval=%f", NULL, changeSnapshotInterval, "Seconds between two snapshots (default is 60).");
+    addArgument("--snapshot-incremental", NULL, snapshotIncrementalOn, "Append the memory pages changed since the last snapshot to its file, instead of writing it again.");
+    addArgument("--resume=%s", NULL, resumeOn, "Continue the program from the given snapshot, with the same options and input.");
+    addArgument("--output=%s", "-o=%s", changeOutputMode, "Output buffering: line or full (default is line for terminals, full otherwise).");
+    addArgument("--input=%s", "-i=%s", changeInputMode, "Input mode: interactive or stream (default is interactive for terminals, stream otherwise).");
+    addArgument("--eof=%s", NULL, changeEofMode, "Value read by , at the end of the input: -1, 0 or unchanged (default is 0 for streamed input and -1 for interactive input).");
+    addArgument("--batch=%s", NULL, batchOn, "Run the program once for every input file named in the given list, one per line (- for the standard input).");
+    addArgument("--threads=%d", NULL, changeThreadNum, "Number of threads of --batch (default is one per processor).");
+    addArgument("--batch-output=%s", NULL, changeBatchOutput, "Outputs of --batch: stream (default, in order on the standard output) or files (input.out next to each input).");
+    addArgument("--emit-c=%s", "-c=%s", emitCOn, "Write a standalone C translation of the program to the given file, instead of running it.");
+    addArgument("--trace=%s", NULL, traceOn, "Record every instruction run, with the pointer and the value of its cell, to the given binary file.");
+    addArgument("--trace-lines=%s", NULL, changeTraceLines, "Only trace the instructions of the given source lines, first-last (either may be left out).");
+    addArgument("--trace-steps=%s", NULL, changeTraceSteps, "Only trace the instructions run after the given loop iterations, first-last (either may be left out).");
+    addArgument("--decode-trace=%s", NULL, decodeTraceOn, "Print the records of a trace of the program written by --trace, instead of running it.");
+    addArgument("--check", NULL, checkOn, "Report the unmatched brackets, the instruction counts, the loop nesting and the cells the pointer may reach, instead of running the program.");
+    if (parseArguments(argc, argv))
+    {
+        return EXIT_FAILURE;
+    }
+    if (action == acNone)
+    {
+        return EXIT_SUCCESS;
+    }
+    if (!fileName)
+    {
+        argumentsUsage("No file specified");
+        return EXIT_FAILURE;
+    }
+    // the messages printed so far come before the errors and the program output
+    fflush(stdout);
+    // a stream ends with 0 unless asked otherwise, so that filters such as
+    // cat.b stop at its end, while the keys asked keep -1
+    if (!eofChosen && !interactiveInput())
+    {
+        options.eofMode = eofZero;
+    }
+    if (action == acCheck)
+    {
+        return checkFile(fileName, &options);
+    }
+    // only the programs run go through the cache, keyed by the options that
+    // change their compilation and their prefix
+    struct Budget prefixBudget;
+    getPrefixBudget(&prefixBudget);
+    const struct CacheOptions cacheOptions = {
+        .directory = cacheDirectory,
+        .debugCommands = options.debugMode,
+        .cellBits = options.cellBits,
+        .memorySize = options.memorySize,
+        .tapeMode = options.tapeMode,
+        .prefixSteps = prefixBudget.steps,
+        .prefixOutputBytes = prefixBudget.outputBytes,
+    };
+    const struct CacheOptions *const cache = (cacheDirectory && action != acEmitC && action != acDecodeTrace) ? &cacheOptions : NULL;
+    program = loadProgram(fileName, options.debugMode, cache);
+    if (!program)
+    {
+        return EXIT_FAILURE;
+    }
+    int result = EXIT_SUCCESS;
+    if (action == acEmitC)
+    {
+        result = emitCFile(program);
+    }
+    else if (action == acDecodeTrace)
+    {
+        result = printTraceFile(program);
+    }
+    else if (traceFileName && options.profileMode)
+    {
+        fprintf(stderr, "[Error]: The profiler can't be used with --trace\n");
+        result = EXIT_FAILURE;
+    }
+    else if (action == acBatch && traceFileName)
+    {
+        fprintf(stderr, "[Error]: The trace can't be used with --batch\n");
+        result = EXIT_FAILURE;
+    }
+    else if (action == acBatch && options.profileMode)
+    {
+        fprintf(stderr, "[Error]: The profiler can't be used with --batch\n");
+        result = EXIT_FAILURE;
+    }
+    else if (action == acBatch && (snapshotFileName || resumeFileName))
+    {
+        fprintf(stderr, "[Error]: Snapshots can't be used with --batch\n");
+        result = EXIT_FAILURE;
+    }
+    else if (action == acBatch)
+    {
+        // the timer signal belongs to the whole process, so each input has
+        // its own deadline instead, checked with the other limits
+        if (timeoutSeconds > 0.0)
+        {
+            budget.milliseconds = timeoutSeconds < 1e-3 ? 1 : (unsigned long long)(timeoutSeconds * 1000);
+        }
+        completeProgram(program, cache);
+        result = runBatch(program, &options, &budget, batchListName, threadNum, batchOutput);
+    }
+    else
+    {
+        completeProgram(program, cache);
+        result = runProgram(program);
+    }
+    unloadProgram(program);
+    return result;
+}
+
+//------------------------------------------------------------------------------
+// END
+//------------------------------------------------------------------------------
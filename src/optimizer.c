@@ -0,0 +1,209 @@
+//------------------------------------------------------------------------------
+// LIBRARIES
+//------------------------------------------------------------------------------
+
+#include "optimizer.h"
+
+//------------------------------------------------------------------------------
+// DEFINITIONS
+//------------------------------------------------------------------------------
+
+// Maximum number of distinct cells touched by a loop turned into multiplications
+#define MAX_MULTIPLY_CELLS 16
+
+//------------------------------------------------------------------------------
+// USER TYPES
+//------------------------------------------------------------------------------
+
+struct CellDelta
+{
+    int offset;
+    int delta;
+};
+
+//------------------------------------------------------------------------------
+// FUNCTIONS
+//------------------------------------------------------------------------------
+
+static int isFoldable(const enum OpCode code)
+{
+    return (code == opMove || code == opAdd);
+}
+
+// Translates a balanced loop whose body only moves the pointer and adds
+// constants to cells, and decrements (or increments) the cell at the loop
+// pointer by one, into a sequence of multiply-accumulate operations followed
+// by a clear. Returns the number of operations written to out, or zero if
+// the loop doesn't match this pattern.
+static unsigned int multiplyLoop(const struct Op *const body, const unsigned int bodyLength, struct Op *const out)
+{
+    struct CellDelta cells[MAX_MULTIPLY_CELLS];
+    unsigned int cellNum = 0;
+    int position = 0, minPosition = 0, maxPosition = 0;
+    for (unsigned int opIdx = 0; opIdx < bodyLength; opIdx++)
+    {
+        if (body[opIdx].code == opMove)
+        {
+            position += body[opIdx].arg;
+            minPosition = position < minPosition ? position : minPosition;
+            maxPosition = position > maxPosition ? position : maxPosition;
+            continue;
+        }
+        unsigned int cellIdx;
+        for (cellIdx = 0; cellIdx < cellNum && cells[cellIdx].offset != position; cellIdx++)
+            ;
+        if (cellIdx == cellNum)
+        {
+            if (cellNum >= MAX_MULTIPLY_CELLS)
+            {
+                return 0;
+            }
+            cells[cellNum++] = (struct CellDelta){.offset = position, .delta = 0};
+        }
+        cells[cellIdx].delta += body[opIdx].arg;
+    }
+    if (position)
+    {
+        return 0;
+    }
+    // the loop counter is the cell at offset zero
+    int counterDelta = 0;
+    int touchedMin = 0, touchedMax = 0;
+    for (unsigned int cellIdx = 0; cellIdx < cellNum; cellIdx++)
+    {
+        if (!cells[cellIdx].offset)
+        {
+            counterDelta = cells[cellIdx].delta;
+        }
+        else if (cells[cellIdx].delta)
+        {
+            touchedMin = cells[cellIdx].offset < touchedMin ? cells[cellIdx].offset : touchedMin;
+            touchedMax = cells[cellIdx].offset > touchedMax ? cells[cellIdx].offset : touchedMax;
+        }
+    }
+    // the bounds check is done on the touched cells, so the loop may not walk past them
+    if ((counterDelta != -1 && counterDelta != 1) || minPosition < touchedMin || maxPosition > touchedMax)
+    {
+        return 0;
+    }
+    unsigned int outNum = 0;
+    for (unsigned int cellIdx = 0; cellIdx < cellNum; cellIdx++)
+    {
+        if (cells[cellIdx].offset && cells[cellIdx].delta)
+        {
+            out[outNum++] = (struct Op){
+                .code = opMultiply,
+                .arg = -counterDelta * cells[cellIdx].delta,
+                .offset = cells[cellIdx].offset,
+            };
+        }
+    }
+    out[outNum++] = (struct Op){.code = opClear};
+    return outNum;
+}
+
+// Recognizes innermost loops with well known effects: clear loops like [-],
+// scan loops like [>] or [<<] and copy/multiply loops like [->++>+++<<]
+static unsigned int replaceLoop(const struct Op *const body, const unsigned int bodyLength, struct Op *const out)
+{
+    if (bodyLength == 1 && body[0].code == opAdd && (body[0].arg == 1 || body[0].arg == -1))
+    {
+        out[0] = (struct Op){.code = opClear};
+        return 1;
+    }
+    if (bodyLength == 1 && body[0].code == opMove)
+    {
+        out[0] = (struct Op){.code = opScan, .arg = body[0].arg};
+        return 1;
+    }
+    return multiplyLoop(body, bodyLength, out);
+}
+
+static void replaceIdioms(struct Program *const program)
+{
+    struct Op replacement[MAX_MULTIPLY_CELLS + 1];
+    unsigned int opNum = 0;
+    for (unsigned int opIdx = 0; opIdx < program->opNum; opIdx++)
+    {
+        if (program->ops[opIdx].code == opBeginLoop)
+        {
+            // only loops without nested loops, I/O or debug commands are candidates
+            unsigned int endIdx = opIdx + 1;
+            while (endIdx < program->opNum && isFoldable(program->ops[endIdx].code))
+            {
+                endIdx++;
+            }
+            if (endIdx < program->opNum && program->ops[endIdx].code == opEndLoop)
+            {
+                const unsigned int replacementNum = replaceLoop(&program->ops[opIdx + 1], endIdx - opIdx - 1, replacement);
+                if (replacementNum)
+                {
+                    // the replacement is never longer than the loop it replaces
+                    const size_t offset = program->offsets[opIdx];
+                    for (unsigned int replacementIdx = 0; replacementIdx < replacementNum; replacementIdx++)
+                    {
+                        program->ops[opNum] = replacement[replacementIdx];
+                        program->offsets[opNum] = offset;
+                        opNum++;
+                    }
+                    opIdx = endIdx;
+                    continue;
+                }
+            }
+        }
+        program->ops[opNum] = program->ops[opIdx];
+        program->offsets[opNum] = program->offsets[opIdx];
+        opNum++;
+    }
+    program->opNum = opNum;
+}
+
+// Merges the clears of neighbouring cells, like [-]>[-]>[-], into a single
+// clear of the whole range, which leaves the pointer on its last cell
+static void mergeClears(struct Program *const program)
+{
+    unsigned int opNum = 0;
+    for (unsigned int opIdx = 0; opIdx < program->opNum; opIdx++)
+    {
+        const struct Op op = program->ops[opIdx];
+        if (op.code == opClear)
+        {
+            int distance = 0;
+            unsigned int lastIdx = opIdx;
+            while (lastIdx + 2 < program->opNum && program->ops[lastIdx + 1].code == opMove && program->ops[lastIdx + 2].code == opClear)
+            {
+                // the range goes in the direction of its first move
+                const int direction = program->ops[lastIdx + 1].arg;
+                if ((direction != 1 && direction != -1) || (distance && (distance > 0) != (direction > 0)))
+                {
+                    break;
+                }
+                distance += direction;
+                lastIdx += 2;
+            }
+            if (distance)
+            {
+                program->ops[opNum] = (struct Op){.code = opClearRange, .arg = distance};
+                program->offsets[opNum] = program->offsets[opIdx];
+                opNum++;
+                opIdx = lastIdx;
+                continue;
+            }
+        }
+        program->ops[opNum] = op;
+        program->offsets[opNum] = program->offsets[opIdx];
+        opNum++;
+    }
+    program->opNum = opNum;
+}
+
+// Must be called before the loops are linked, as operations are moved around
+void optimizeProgram(struct Program *const program)
+{
+    replaceIdioms(program);
+    mergeClears(program);
+}
+
+//------------------------------------------------------------------------------
+// END
+//------------------------------------------------------------------------------
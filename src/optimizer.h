@@ -0,0 +1,19 @@
+#ifndef __OPTIMIZER
+#define __OPTIMIZER
+
+//------------------------------------------------------------------------------
+// LIBRARIES
+//------------------------------------------------------------------------------
+
+#include "program.h"
+
+//------------------------------------------------------------------------------
+// FUNCTION PROTOTYPES
+//------------------------------------------------------------------------------
+
+void optimizeProgram(struct Program *const program);
+
+//------------------------------------------------------------------------------
+// END
+//------------------------------------------------------------------------------
+#endif // __OPTIMIZER
@@ -2,32 +2,42 @@
 // LIBRARIES
 //------------------------------------------------------------------------------
 
+#include <limits.h>
+#include <pthread.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include "parser.h"
+#include "program.h"
+#include "optimizer.h"
+#include "engine.h"
+#include "tape.h"
+#include "io.h"
 
 //------------------------------------------------------------------------------
 // USER TYPES
 //------------------------------------------------------------------------------
 
-struct Environment
+// Operations of the reference engine, which return runFinished when done
+typedef enum RunStatus (*InstFunction)(struct Environment *);
+
+// Every byte is a comment unless it is registered as a command
+enum CommandClass
 {
-    const char *prog;
-    unsigned int line;
-    unsigned int col;
-    unsigned int mIndex;
-    unsigned int maxIndex;
-    int loop;
-    int *mem;
+    commandComment = 0,
+    // only compiled in debug mode
+    commandDebug,
+    commandLanguage,
 };
 
-typedef int (*InstFunction)(struct Environment *);
-
+// A command is compiled to an operation, which the engines run through its
+// code, as they do for the operations of the optimizer
 struct Instruction
 {
-    char cmd;
-    InstFunction function;
+    enum CommandClass commandClass;
+    enum OpCode code;
+    int arg;
     const char *description;
 };
 
@@ -35,283 +45,374 @@ struct Instruction
 // GLOBAL VARIABLES
 //------------------------------------------------------------------------------
 
-static struct Instruction *instList = NULL;
-static unsigned int instNum = 0;
-
-unsigned int memorySize = 30000;
-int debugMode = 0;
+// Commands indexed by their byte, so the compiler classifies every byte of
+// source code, comments included, with a single lookup. They are registered
+// once for the process by addInstruction(), in the order of the language
+// instructions.
+static struct Instruction instructions[UCHAR_MAX + 1];
+static char instructionOrder[UCHAR_MAX + 1];
+static unsigned int instructionNum = 0;
+static pthread_once_t instructionsOnce = PTHREAD_ONCE_INIT;
 
 //------------------------------------------------------------------------------
 // FUNCTIONS
 //------------------------------------------------------------------------------
 
-static void nextProg(struct Environment *const env)
+static void runtimeError(struct Environment *const env, const char *const msg)
 {
-    env->prog++;
-    env->col++;
-    if (*env->prog == '\n')
-    {
-        env->line++;
-        env->col = 0;
-    }
+    env->error = msg;
 }
 
-static void previousProg(struct Environment *const env)
+// The reference engine favours simplicity over speed: every access selects
+// the cell width at run time, while the other engines are specialized for it
+static unsigned int getCell(const struct Environment *const env, const unsigned int index)
 {
-    env->prog--;
-    env->col--;
-    if (*env->prog == '\n')
+    switch (env->options.cellBits)
     {
-        env->line--;
-        env->col = 0;
+    case 8:
+        return ((const uint8_t *)env->mem)[index];
+    case 16:
+        return ((const uint16_t *)env->mem)[index];
+    default:
+        return ((const uint32_t *)env->mem)[index];
     }
 }
 
-static void codeError(struct Environment *const env, const char *const msg)
+static void setCell(struct Environment *const env, const unsigned int index, const unsigned int value)
 {
-    fprintf(stderr, "\n[Error in line %d, column %d]: %s\n", env->line, env->col, msg);
-    for (unsigned int columns = env->col; columns > 1; columns--)
-    {
-        env->prog--;
-    }
-    int lineLength = strchr(env->prog, '\n') - env->prog;
-    fprintf(stderr, "%.*s\n", lineLength, env->prog);
-    for (unsigned int columns = env->col; columns > 1; columns--)
+    switch (env->options.cellBits)
     {
-        putc(' ', stderr);
+    case 8:
+        ((uint8_t *)env->mem)[index] = value;
+        break;
+    case 16:
+        ((uint16_t *)env->mem)[index] = value;
+        break;
+    default:
+        ((uint32_t *)env->mem)[index] = value;
+        break;
     }
-    fprintf(stderr, "^\n");
 }
 
-static int incrementIndex(struct Environment *env)
+static int checkIndex(struct Environment *const env, const long long index)
 {
-    env->mIndex++;
-    if (env->mIndex >= memorySize)
+    if (index < env->lowIndex || index >= env->size)
     {
-        codeError(env, "Invalid pointer address");
+        runtimeError(env, "Invalid pointer address");
         return EXIT_FAILURE;
     }
-    env->maxIndex = env->maxIndex > env->mIndex ? env->maxIndex : env->mIndex;
+    env->minIndex = env->minIndex < index ? env->minIndex : index;
+    env->maxIndex = env->maxIndex > index ? env->maxIndex : index;
     return EXIT_SUCCESS;
 }
 
-static int decrementIndex(struct Environment *env)
+static enum RunStatus moveIndex(struct Environment *env)
 {
-    if (env->mIndex == 0)
+    // a folded run of moves is checked only once, against its final position
+    const long long index = (long long)env->mIndex + env->op->arg;
+    if (checkIndex(env, index))
     {
-        codeError(env, "Invalid pointer address");
-        return EXIT_FAILURE;
+        return runError;
     }
-    env->mIndex--;
-    return EXIT_SUCCESS;
+    env->mIndex = index;
+    return runFinished;
 }
 
-static int incrementByte(struct Environment *env)
+static enum RunStatus addByte(struct Environment *env)
 {
-    env->mem[env->mIndex]++;
-    return EXIT_SUCCESS;
+    setCell(env, env->mIndex, getCell(env, env->mIndex) + (unsigned int)env->op->arg);
+    return runFinished;
 }
 
-static int decrementByte(struct Environment *env)
+static enum RunStatus outputByte(struct Environment *env)
 {
-    env->mem[env->mIndex]--;
-    return EXIT_SUCCESS;
+    writeByte(&env->output, getCell(env, env->mIndex));
+    return runFinished;
 }
 
-static int outputByte(struct Environment *env)
+static enum RunStatus getByte(struct Environment *env)
 {
-    putchar(env->mem[env->mIndex]);
-    return EXIT_SUCCESS;
+    setCell(env, env->mIndex, readByte(&env->input, getCell(env, env->mIndex)));
+    return runFinished;
 }
 
-static int getByte(struct Environment *env)
+static enum RunStatus beginLoop(struct Environment *env)
 {
-    printf("\nInsert a key:\n");
-    env->mem[env->mIndex] = getchar();
-    putchar('\n');
-    return EXIT_SUCCESS;
+    if (!getCell(env, env->mIndex))
+    {
+        // jump to the end of loop
+        env->op = &env->program->ops[env->op->arg];
+    }
+    return runFinished;
 }
 
-static int beginLoop(struct Environment *env)
+static enum RunStatus endLoop(struct Environment *env)
 {
-    if (env->mem[env->mIndex])
+    if (getCell(env, env->mIndex))
     {
-        env->loop++;
-    }
-    else
-    {
-        // find end of loop
-        int loop = 1;
-        do
+        // return to the begin of the loop, where the run continues if it stops
+        env->op = &env->program->ops[env->op->arg];
+        if (!--env->countdown && checkBudget(env))
         {
-            nextProg(env);
-            switch (*env->prog)
-            {
-            case '[':
-                loop++;
-                break;
-            case ']':
-                loop--;
-                break;
-            case '\0':
-                env->prog--;
-                codeError(env, "Missing end of the loop ']'");
-                return EXIT_FAILURE;
-            }
-        } while (loop);
+            return runStopped;
+        }
     }
-    return EXIT_SUCCESS;
+    return runFinished;
 }
 
-static int endLoop(struct Environment *env)
+static enum RunStatus clearByte(struct Environment *env)
 {
-    if (env->mem[env->mIndex])
+    setCell(env, env->mIndex, 0);
+    return runFinished;
+}
+
+static enum RunStatus multiplyByte(struct Environment *env)
+{
+    if (getCell(env, env->mIndex))
     {
-        // return to the begin of the loop
-        int loop = 1;
-        do
+        const long long index = (long long)env->mIndex + env->op->offset;
+        if (checkIndex(env, index))
         {
-            previousProg(env);
-            switch (*env->prog)
-            {
-            case '[':
-                loop--;
-                break;
-            case ']':
-                loop++;
-                break;
-            }
-        } while (loop);
+            return runError;
+        }
+        setCell(env, index, getCell(env, index) + getCell(env, env->mIndex) * (unsigned int)env->op->arg);
     }
-    else
+    return runFinished;
+}
+
+static enum RunStatus scanByte(struct Environment *env)
+{
+    // search for the first zero cell, in steps of the scan stride
+    long long index = env->mIndex;
+    while (getCell(env, index))
     {
-        env->loop--;
-        if (env->loop < 0)
+        index += env->op->arg;
+        if (checkIndex(env, index))
         {
-            codeError(env, "Incorrect loop declaration");
-            return EXIT_FAILURE;
+            return runError;
         }
     }
-    return EXIT_SUCCESS;
+    env->mIndex = index;
+    return runFinished;
 }
 
-static int printCell(struct Environment *env)
+static enum RunStatus clearRange(struct Environment *env)
 {
-    if (debugMode)
+    const long long index = (long long)env->mIndex + env->op->arg;
+    if (checkIndex(env, index))
     {
-        printf("\ncell %d: %d\n", env->mIndex, env->mem[env->mIndex]);
+        return runError;
     }
-    return EXIT_SUCCESS;
+    const int direction = env->op->arg < 0 ? -1 : 1;
+    for (long long cell = env->mIndex; cell != index + direction; cell += direction)
+    {
+        setCell(env, cell, 0);
+    }
+    env->mIndex = index;
+    return runFinished;
 }
 
-static int printAllCells(struct Environment *env)
+static enum RunStatus printCell(struct Environment *env)
 {
-    if (debugMode)
+    if (env->options.debugMode)
     {
-        printf("\n");
-        for (unsigned int index = 0; index <= env->maxIndex; index++)
-        {
-            printf("cell %d: %d\n", index, env->mem[index]);
-        }
+        outputPrintf(&env->output, "\ncell %d: %u\n", (int)(env->mIndex - env->origin), getCell(env, env->mIndex));
     }
-    return EXIT_SUCCESS;
+    return runFinished;
 }
 
-static int addInstruction(const char cmd, InstFunction function, const char *const description)
+static enum RunStatus printAllCells(struct Environment *env)
 {
-    if (cmd && function)
+    if (env->options.debugMode)
     {
-        struct Instruction *newList = (struct Instruction *)realloc((void *)instList, (instNum + 1) * sizeof(struct Instruction));
-        if (newList)
+        outputPrintf(&env->output, "\n");
+        for (unsigned int index = nextTouchedCell(env, env->minIndex); index <= env->maxIndex; index = nextTouchedCell(env, index + 1))
         {
-            instList = newList;
-            instList[instNum] = (struct Instruction){
-                .cmd = cmd,
-                .function = function,
-                .description = description,
-            };
-            instNum++;
-            return EXIT_SUCCESS;
+            outputPrintf(&env->output, "cell %d: %u\n", (int)(index - env->origin), getCell(env, index));
         }
     }
-    return EXIT_FAILURE;
+    return runFinished;
 }
 
-void endBrainFuck(void)
+static void addInstruction(const char cmd, const enum CommandClass commandClass, const enum OpCode code, const int arg, const char *const description)
 {
-    free((struct Instruction *)instList);
-    instList = NULL;
-    instNum = 0;
+    instructions[(unsigned char)cmd] = (struct Instruction){commandClass, code, arg, description};
+    instructionOrder[instructionNum++] = cmd;
 }
 
-void initBrainFuck(void)
+static void initInstructions(void)
 {
-    atexit(endBrainFuck);
-    addInstruction('>', incrementIndex, "Increment the data pointer.");
-    addInstruction('<', decrementIndex, "Decrement the data pointer.");
-    addInstruction('+', incrementByte, "Increment the byte at the data pointer.");
-    addInstruction('-', decrementByte, "Decrement the byte at the data pointer.");
-    addInstruction('.', outputByte, "Output the byte at the data pointer.");
-    addInstruction(',', getByte, "Get one byte from the input and stores it at the data pointer.");
-    addInstruction('[', beginLoop, "If the byte at the data pointer is non zero, then loop the instructions inside the brackets [ ].");
-    addInstruction(']', endLoop, "End of loop.");
-    addInstruction('#', printCell, "Print current cell and its value (Debug mode only).");
-    addInstruction('@', printAllCells, "Print all used cells and its values (Debug mode only).");
+    addInstruction('>', commandLanguage, opMove, 1, "Increment the data pointer.");
+    addInstruction('<', commandLanguage, opMove, -1, "Decrement the data pointer.");
+    addInstruction('+', commandLanguage, opAdd, 1, "Increment the byte at the data pointer.");
+    addInstruction('-', commandLanguage, opAdd, -1, "Decrement the byte at the data pointer.");
+    addInstruction('.', commandLanguage, opOutputByte, 0, "Output the byte at the data pointer.");
+    addInstruction(',', commandLanguage, opGetByte, 0, "Get one byte from the input and stores it at the data pointer.");
+    addInstruction('[', commandLanguage, opBeginLoop, 0, "If the byte at the data pointer is non zero, then loop the instructions inside the brackets [ ].");
+    addInstruction(']', commandLanguage, opEndLoop, 0, "End of loop.");
+    addInstruction('#', commandDebug, opPrintCell, 0, "Print current cell and its value (Debug mode only).");
+    addInstruction('@', commandDebug, opPrintAllCells, 0, "Print all used cells and its values (Debug mode only).");
 }
 
+// Functions of all the operations, including the ones generated by the
+// optimizer, which have no command
+static const InstFunction opFunctions[opNum] = {
+    [opMove] = moveIndex,
+    [opAdd] = addByte,
+    [opOutputByte] = outputByte,
+    [opGetByte] = getByte,
+    [opBeginLoop] = beginLoop,
+    [opEndLoop] = endLoop,
+    [opPrintCell] = printCell,
+    [opPrintAllCells] = printAllCells,
+    [opClear] = clearByte,
+    [opMultiply] = multiplyByte,
+    [opScan] = scanByte,
+    [opClearRange] = clearRange,
+};
+
 void printInstructions(void)
 {
+    pthread_once(&instructionsOnce, initInstructions);
     printf("[Language Instructions]\n");
-    for (unsigned int instIdx = 0; instIdx < instNum; instIdx++)
+    for (unsigned int instIdx = 0; instIdx < instructionNum; instIdx++)
+    {
+        printf("   %c   %s\n", instructionOrder[instIdx], instructions[(unsigned char)instructionOrder[instIdx]].description);
+    }
+}
+
+// Runs of moves or additions are folded as they are compiled, into a single
+// operation located at the first instruction of the run, so the memory of the
+// compiler follows the operations instead of the size of the source. Runs
+// that cancel out are removed.
+static int appendCommand(struct Program *const program, const struct Instruction *const inst, const size_t offset)
+{
+    struct Op *const last = program->opNum ? &program->ops[program->opNum - 1] : NULL;
+    if (last && last->code == inst->code && (inst->code == opMove || inst->code == opAdd))
     {
-        printf("   %c   %s\n", instList[instIdx].cmd, instList[instIdx].description);
+        last->arg += inst->arg;
+        if (!last->arg)
+        {
+            program->opNum--;
+        }
+        return EXIT_SUCCESS;
     }
+    return appendOp(program, (struct Op){.code = inst->code, .arg = inst->arg}, offset);
 }
 
-void brainFuck(const char *const code)
+// Compiles a chunk of source code, continuing from where the previous one ended
+int compileBrainFuck(struct Program *const program, const char *const code, const size_t length)
 {
-    // Initiates program variables
-    struct Environment *env = (struct Environment *)malloc(sizeof(struct Environment));
-    *env = (struct Environment){
-        .mIndex = 0,
-        .maxIndex = 0,
-        .loop = 0,
-        .line = 1,
-        .col = 1,
-        .prog = code,
-        .mem = NULL,
-    };
-    // Initiates program memory
-    env->mem = (int *)malloc(memorySize * sizeof(int));
-    memset(env->mem, 0, memorySize * sizeof(int));
-
-    for (; *env->prog; nextProg(env))
+    // without the debug mode, the debug commands are comments, so they
+    // don't get in the way of the optimizer
+    const enum CommandClass lowestClass = program->debugCommands ? commandDebug : commandLanguage;
+    pthread_once(&instructionsOnce, initInstructions);
+    for (size_t index = 0; index < length; index++)
     {
-        // sequential search teh instruction table
-        for (unsigned int instIdx = 0; instIdx < instNum; instIdx++)
+        const size_t offset = program->next + index;
+        if (code[index] == '\n' && appendLine(program, offset + 1))
+        {
+            return EXIT_FAILURE;
+        }
+        const struct Instruction *const inst = &instructions[(unsigned char)code[index]];
+        if (inst->commandClass >= lowestClass && appendCommand(program, inst, offset))
         {
-            if (*env->prog == instList[instIdx].cmd)
+            return EXIT_FAILURE;
+        }
+    }
+    program->next += length;
+    return EXIT_SUCCESS;
+}
+
+// Resolves the matching brackets before the execution, so loops jump in O(1)
+static int linkLoops(struct Program *const program)
+{
+    // the open loops are chained through their own arg field, from the innermost one
+    const unsigned int noLoop = program->opNum;
+    unsigned int openLoop = noLoop;
+    for (unsigned int opIdx = 0; opIdx < program->opNum; opIdx++)
+    {
+        struct Op *const op = &program->ops[opIdx];
+        if (op->code == opBeginLoop)
+        {
+            op->arg = openLoop;
+            openLoop = opIdx;
+        }
+        else if (op->code == opEndLoop)
+        {
+            if (openLoop == noLoop)
             {
-                if (!instList[instIdx].function(env))
-                {
-                    break;
-                }
-                else
-                {
-                    // something wrong appened
-                    goto exitBrainFuck;
-                }
+                codeError(program, opIdx, "Incorrect loop declaration");
+                return EXIT_FAILURE;
             }
+            struct Op *const begin = &program->ops[openLoop];
+            const unsigned int outerLoop = begin->arg;
+            begin->arg = opIdx;
+            op->arg = openLoop;
+            openLoop = outerLoop;
         }
-        // didn't found valid instruction in the table, so ignores
     }
-    if (env->loop)
+    if (openLoop != noLoop)
     {
-        codeError(env, "Incorrect loop declaration");
+        codeError(program, openLoop, "Missing end of the loop ']'");
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
+
+// Must be called after the whole source code was compiled
+int finishBrainFuck(struct Program *const program)
+{
+    if (appendOp(program, (struct Op){.code = opEnd}, program->next))
+    {
+        fprintf(stderr, "\n[Error]: Couldn't compile the program: out of memory\n");
+        return EXIT_FAILURE;
+    }
+    optimizeProgram(program);
+    return linkLoops(program);
+}
+
+struct Program *compileProgram(const char *const code, const size_t length, const int debugCommands)
+{
+    struct Program *program = newProgram(code, length, debugCommands);
+    if (!program)
+    {
+        fprintf(stderr, "\n[Error]: Couldn't compile the program: out of memory\n");
+        return NULL;
+    }
+    if (compileBrainFuck(program, code, length))
+    {
+        fprintf(stderr, "\n[Error]: Couldn't compile the program: out of memory\n");
+        freeProgram(program);
+        return NULL;
+    }
+    if (finishBrainFuck(program))
+    {
+        freeProgram(program);
+        return NULL;
+    }
+    return program;
+}
+
+// The environments of the library choose the debug mode after the
+// compilation, so its programs keep the debug commands
+struct Program *loadBrainFuck(const char *const code, const size_t length)
+{
+    return compileProgram(code, length, 1);
+}
+
+enum RunStatus runReference(struct Environment *const env)
+{
+    for (; env->op->code != opEnd; env->op++)
+    {
+        const enum RunStatus status = opFunctions[env->op->code](env);
+        if (status != runFinished)
+        {
+            // something wrong appened, or the budget ran out
+            return status;
+        }
     }
-exitBrainFuck:
-    free((void *)env->mem);
-    free((void *)env);
+    return runFinished;
 }
 
 //------------------------------------------------------------------------------
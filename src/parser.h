@@ -2,20 +2,22 @@
 #define __PARSER
 
 //------------------------------------------------------------------------------
-// FUNCTION PROTOTYPES
+// LIBRARIES
 //------------------------------------------------------------------------------
 
-void endBrainFuck(void);
-void initBrainFuck(void);
-void printInstructions(void);
-void brainFuck(const char *const code);
+#include "brainfuck.h"
+#include "program.h"
+#include "engine.h"
 
 //------------------------------------------------------------------------------
-// GLOBAL VARIABLES
+// FUNCTION PROTOTYPES
 //------------------------------------------------------------------------------
 
-extern unsigned int memorySize;
-extern int debugMode;
+void printInstructions(void);
+int compileBrainFuck(struct Program *const program, const char *const code, const size_t length);
+int finishBrainFuck(struct Program *const program);
+struct Program *compileProgram(const char *const code, const size_t length, const int debugCommands);
+enum RunStatus runReference(struct Environment *const env);
 
 //------------------------------------------------------------------------------
 // END
@@ -0,0 +1,234 @@
+//------------------------------------------------------------------------------
+// LIBRARIES
+//------------------------------------------------------------------------------
+
+#include <stdlib.h>
+#include <string.h>
+#include "prefix.h"
+#include "tape.h"
+
+//------------------------------------------------------------------------------
+// USER TYPES
+//------------------------------------------------------------------------------
+
+// Output of the prefix, kept in memory
+struct PrefixOutput
+{
+    unsigned char *data;
+    size_t size;
+    size_t capacity;
+    int failed;
+};
+
+//------------------------------------------------------------------------------
+// FUNCTIONS
+//------------------------------------------------------------------------------
+
+static size_t collectOutput(void *user, const unsigned char *data, size_t size)
+{
+    struct PrefixOutput *const output = (struct PrefixOutput *)user;
+    if (output->size + size > output->capacity)
+    {
+        size_t capacity = output->capacity ? output->capacity : 4096;
+        while (capacity < output->size + size)
+        {
+            capacity *= 2;
+        }
+        unsigned char *const newData = (unsigned char *)realloc((void *)output->data, capacity);
+        if (!newData)
+        {
+            output->failed = 1;
+            return 0;
+        }
+        output->data = newData;
+        output->capacity = capacity;
+    }
+    memcpy(&output->data[output->size], data, size);
+    output->size += size;
+    return size;
+}
+
+static size_t noInput(void *user, unsigned char *data, size_t size)
+{
+    (void)user;
+    (void)data;
+    (void)size;
+    return 0;
+}
+
+static void addRun(const struct Environment *const env, struct PrefixRun *const runs, unsigned char *const cells, size_t *const runNum, size_t *const cellNum, const unsigned int first, const unsigned int last)
+{
+    const size_t cellSize = env->options.cellBits / 8;
+    if (runs)
+    {
+        runs[*runNum] = (struct PrefixRun){.firstCell = (long long)first - env->origin, .cellNum = last - first + 1};
+        memcpy(&cells[*cellNum * cellSize], (const unsigned char *)env->mem + (size_t)first * cellSize, (size_t)(last - first + 1) * cellSize);
+    }
+    (*runNum)++;
+    *cellNum += last - first + 1;
+}
+
+// Finds the runs of cells that aren't zero, without reading the pages of the
+// paged tapes that were never touched. Returns their number and the total of
+// their cells, and copies them if runs and cells are given.
+static size_t findRuns(struct Environment *const env, struct PrefixRun *const runs, unsigned char *const cells, size_t *const cellNum)
+{
+    static const unsigned char zero[sizeof(uint32_t)] = {0};
+    const size_t cellSize = env->options.cellBits / 8;
+    const unsigned char *const mem = (const unsigned char *)env->mem;
+    size_t runNum = 0;
+    unsigned int first = 0;
+    unsigned int last = 0;
+    int inRun = 0;
+    *cellNum = 0;
+    for (unsigned int index = nextTouchedCell(env, env->minIndex); index <= env->maxIndex; index = nextTouchedCell(env, index + 1))
+    {
+        if (!memcmp(mem + (size_t)index * cellSize, zero, cellSize))
+        {
+            continue;
+        }
+        if (inRun && index - last > PREFIX_RUN_GAP)
+        {
+            addRun(env, runs, cells, &runNum, cellNum, first, last);
+            inRun = 0;
+        }
+        if (!inRun)
+        {
+            first = index;
+            inRun = 1;
+        }
+        last = index;
+    }
+    if (inRun)
+    {
+        addRun(env, runs, cells, &runNum, cellNum, first, last);
+    }
+    return runNum;
+}
+
+// The runs and their cells follow the prefix in the same allocation
+static struct Prefix *newPrefix(struct Environment *const env, const unsigned int opIdx, struct PrefixOutput *const output)
+{
+    const size_t cellSize = env->options.cellBits / 8;
+    size_t cellNum;
+    const size_t runNum = findRuns(env, NULL, NULL, &cellNum);
+    struct Prefix *const prefix = (struct Prefix *)malloc(sizeof(struct Prefix) + runNum * sizeof(struct PrefixRun) + cellNum * cellSize);
+    if (!prefix)
+    {
+        return NULL;
+    }
+    struct PrefixRun *const runs = (struct PrefixRun *)(prefix + 1);
+    unsigned char *const cells = (unsigned char *)(runs + runNum);
+    findRuns(env, runs, cells, &cellNum);
+    struct Usage usage;
+    environmentUsage(env, &usage);
+    *prefix = (struct Prefix){
+        .cellBits = env->options.cellBits,
+        .opIdx = opIdx,
+        .minCell = (long long)env->minIndex - env->origin,
+        .maxCell = (long long)env->maxIndex - env->origin,
+        .pointer = (long long)env->mIndex - env->origin,
+        .runs = runs,
+        .runNum = runNum,
+        .cells = cells,
+        .steps = usage.steps,
+        .output = output->data,
+        .outputSize = output->size,
+    };
+    output->data = NULL;
+    return prefix;
+}
+
+// Runs the program at load time, with the options of its environments, until
+// its first input, the end of the budget or of the program, and keeps its
+// state for the environments. The program must not be shared yet. The
+// operations that read the input or print the cells are replaced by the end
+// of the program, in a copy of it whose loops are the same, so the engines
+// stop right before them.
+int evaluatePrefix(struct Program *const program, const struct Options *const options, const struct Budget *const budget)
+{
+    struct Op *const ops = (struct Op *)malloc(program->opNum * sizeof(struct Op));
+    if (!ops)
+    {
+        return EXIT_FAILURE;
+    }
+    memcpy((void *)ops, (const void *)program->ops, program->opNum * sizeof(struct Op));
+    for (unsigned int opIdx = 0; opIdx < program->opNum; opIdx++)
+    {
+        if (ops[opIdx].code == opGetByte || ops[opIdx].code == opPrintCell || ops[opIdx].code == opPrintAllCells)
+        {
+            ops[opIdx].code = opEnd;
+        }
+    }
+    struct Program probe = *program;
+    probe.ops = ops;
+    probe.prefix = NULL;
+    struct Options probeOptions = *options;
+    probeOptions.debugMode = 0;
+    probeOptions.profileMode = 0;
+    // the JIT keeps track of the cells reached, as for a snapshot
+    probeOptions.snapshotMode = 1;
+    struct PrefixOutput output = {.data = NULL, .size = 0, .capacity = 0, .failed = 0};
+    const struct Io io = {.read = noInput, .write = collectOutput, .user = &output, .lineBuffered = 0};
+    struct Environment *const env = newEnvironment(&probe, &probeOptions, &io);
+    int result = EXIT_FAILURE;
+    if (env)
+    {
+        const enum RunStatus status = runEnvironment(env, budget);
+        const unsigned int opIdx = env->op - ops;
+        // the output discarded beyond its limit can't be written again
+        if (opIdx && !output.failed && (status == runFinished || (status == runStopped && env->stopReason != stopOutput)))
+        {
+            program->prefix = newPrefix(env, opIdx, &output);
+            result = program->prefix ? EXIT_SUCCESS : EXIT_FAILURE;
+        }
+        freeEnvironment(env);
+    }
+    free((void *)output.data);
+    free((void *)ops);
+    return result;
+}
+
+// Starts a new or reset environment from the prefix of its program, if it
+// has the same cell width and a tape that holds the cells reached. The steps
+// and the output of the prefix come with the next run.
+void applyPrefix(struct Environment *const env)
+{
+    const struct Prefix *const prefix = env->program->prefix;
+    if (!prefix || prefix->cellBits != env->options.cellBits || env->profile ||
+        (long long)env->origin + prefix->minCell < (long long)env->lowIndex ||
+        (long long)env->origin + prefix->maxCell >= (long long)env->size)
+    {
+        return;
+    }
+    const size_t cellSize = env->options.cellBits / 8;
+    const unsigned int minIndex = (unsigned int)(env->origin + prefix->minCell);
+    const unsigned int maxIndex = (unsigned int)(env->origin + prefix->maxCell);
+    // the tape is zero, so only the runs are written
+    const unsigned char *cells = prefix->cells;
+    for (size_t runIdx = 0; runIdx < prefix->runNum; runIdx++)
+    {
+        const struct PrefixRun *const run = &prefix->runs[runIdx];
+        const size_t runSize = (size_t)run->cellNum * cellSize;
+        memcpy((unsigned char *)env->mem + (size_t)(env->origin + run->firstCell) * cellSize, cells, runSize);
+        cells += runSize;
+    }
+    env->minIndex = env->minIndex < minIndex ? env->minIndex : minIndex;
+    env->maxIndex = env->maxIndex > maxIndex ? env->maxIndex : maxIndex;
+    env->mIndex = (unsigned int)(env->origin + prefix->pointer);
+    env->op = &env->program->ops[prefix->opIdx];
+    env->prefix = prefix;
+}
+
+void freePrefix(struct Prefix *const prefix)
+{
+    if (prefix)
+    {
+        free((void *)prefix->output);
+        free((void *)prefix);
+    }
+}
+
+//------------------------------------------------------------------------------
+// END
+//------------------------------------------------------------------------------
@@ -0,0 +1,66 @@
+#ifndef __PREFIX
+#define __PREFIX
+
+//------------------------------------------------------------------------------
+// LIBRARIES
+//------------------------------------------------------------------------------
+
+#include <stdint.h>
+#include "brainfuck.h"
+#include "program.h"
+#include "engine.h"
+
+//------------------------------------------------------------------------------
+// DEFINITIONS
+//------------------------------------------------------------------------------
+
+// Zero cells after which a run of cells ends
+#define PREFIX_RUN_GAP 16
+
+//------------------------------------------------------------------------------
+// USER TYPES
+//------------------------------------------------------------------------------
+
+// Cells of the prefix close to each other, the first and the last ones not
+// being zero
+struct PrefixRun
+{
+    // relative to the first cell of the program
+    int64_t firstCell;
+    uint64_t cellNum;
+};
+
+// State of a program after the start that doesn't depend on its input,
+// computed once at load time: the environments with the same cell width
+// continue from there
+struct Prefix
+{
+    unsigned int cellBits;
+    // operation where the program continues
+    unsigned int opIdx;
+    // cells reached and pointer, relative to the first cell of the program
+    long long minCell;
+    long long maxCell;
+    long long pointer;
+    // the cells that aren't zero are in the runs, whose values follow each
+    // other in cells, so a sparse tape keeps its untouched pages
+    struct PrefixRun *runs;
+    size_t runNum;
+    unsigned char *cells;
+    unsigned long long steps;
+    unsigned char *output;
+    size_t outputSize;
+};
+
+//------------------------------------------------------------------------------
+// FUNCTION PROTOTYPES
+//------------------------------------------------------------------------------
+
+int evaluatePrefix(struct Program *const program, const struct Options *const options, const struct Budget *const budget);
+void applyPrefix(struct Environment *const env);
+void freePrefix(struct Prefix *const prefix);
+
+//------------------------------------------------------------------------------
+// END
+//------------------------------------------------------------------------------
+#endif // __PREFIX
@@ -0,0 +1,231 @@
+//------------------------------------------------------------------------------
+// LIBRARIES
+//------------------------------------------------------------------------------
+
+#define _DEFAULT_SOURCE // setitimer, SA_RESTART
+
+#include <pthread.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/time.h>
+#include <time.h>
+#include "profile.h"
+
+//------------------------------------------------------------------------------
+// DEFINITIONS
+//------------------------------------------------------------------------------
+
+// Processor time between two samples
+#define SAMPLE_MICROSECONDS 1000
+// Entries of each table of the report
+#define HOT_SPOT_NUM 10
+
+//------------------------------------------------------------------------------
+// USER TYPES
+//------------------------------------------------------------------------------
+
+// Totals of an operation, or of a loop and everything inside it
+struct HotSpot
+{
+    unsigned int opIdx;
+    unsigned long long count;
+    unsigned long long samples;
+};
+
+//------------------------------------------------------------------------------
+// GLOBAL VARIABLES
+//------------------------------------------------------------------------------
+
+// The timer belongs to the whole process, so one run is profiled at a time
+static struct Profile *volatile sampledProfile = NULL;
+static pthread_once_t handlerOnce = PTHREAD_ONCE_INIT;
+
+//------------------------------------------------------------------------------
+// FUNCTIONS
+//------------------------------------------------------------------------------
+
+static void sampleHandler(const int signal)
+{
+    (void)signal;
+    struct Profile *const profile = sampledProfile;
+    if (profile && profile->current)
+    {
+        profile->samples[profile->current - profile->program->ops]++;
+    }
+}
+
+static void installSampleHandler(void)
+{
+    struct sigaction action;
+    action.sa_handler = sampleHandler;
+    // the reads and writes of the program continue after a sample
+    action.sa_flags = SA_RESTART;
+    sigemptyset(&action.sa_mask);
+    sigaction(SIGPROF, &action, NULL);
+}
+
+struct Profile *newProfile(const struct Program *const program)
+{
+    struct Profile *profile = (struct Profile *)malloc(sizeof(struct Profile));
+    if (!profile)
+    {
+        return NULL;
+    }
+    profile->program = program;
+    profile->counts = (unsigned long long *)calloc(program->opNum, sizeof(unsigned long long));
+    profile->samples = (unsigned long long *)calloc(program->opNum, sizeof(unsigned long long));
+    profile->current = NULL;
+    profile->seconds = 0.0;
+    profile->startSeconds = 0.0;
+    if (!profile->counts || !profile->samples)
+    {
+        freeProfile(profile);
+        return NULL;
+    }
+    return profile;
+}
+
+void freeProfile(struct Profile *const profile)
+{
+    if (profile)
+    {
+        free((void *)profile->counts);
+        free((void *)profile->samples);
+        free((void *)profile);
+    }
+}
+
+static double processorSeconds(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now);
+    return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+void startProfile(struct Profile *const profile)
+{
+    profile->startSeconds = processorSeconds();
+    pthread_once(&handlerOnce, installSampleHandler);
+    sampledProfile = profile;
+    const struct itimerval timer = {
+        .it_interval = {.tv_sec = 0, .tv_usec = SAMPLE_MICROSECONDS},
+        .it_value = {.tv_sec = 0, .tv_usec = SAMPLE_MICROSECONDS},
+    };
+    setitimer(ITIMER_PROF, &timer, NULL);
+}
+
+void stopProfile(struct Profile *const profile)
+{
+    const struct itimerval timer = {
+        .it_interval = {.tv_sec = 0, .tv_usec = 0},
+        .it_value = {.tv_sec = 0, .tv_usec = 0},
+    };
+    setitimer(ITIMER_PROF, &timer, NULL);
+    if (sampledProfile == profile)
+    {
+        sampledProfile = NULL;
+    }
+    profile->seconds += processorSeconds() - profile->startSeconds;
+}
+
+// The hottest first: by time, then by executions
+static int compareHotSpots(const void *const a, const void *const b)
+{
+    const struct HotSpot *const first = (const struct HotSpot *)a;
+    const struct HotSpot *const second = (const struct HotSpot *)b;
+    if (first->samples != second->samples)
+    {
+        return first->samples < second->samples ? 1 : -1;
+    }
+    if (first->count != second->count)
+    {
+        return first->count < second->count ? 1 : -1;
+    }
+    return first->opIdx < second->opIdx ? -1 : 1;
+}
+
+static double percentage(const unsigned long long part, const unsigned long long total)
+{
+    return total ? 100.0 * part / total : 0.0;
+}
+
+// Loops include the operations inside them, which are found in constant
+// time through the running totals of the operations before each one
+static unsigned int collectLoops(const struct Profile *const profile, struct HotSpot *const loops, struct HotSpot *const totals)
+{
+    const struct Program *const program = profile->program;
+    totals[0] = (struct HotSpot){.opIdx = 0, .count = 0, .samples = 0};
+    for (unsigned int opIdx = 0; opIdx < program->opNum; opIdx++)
+    {
+        totals[opIdx + 1].count = totals[opIdx].count + profile->counts[opIdx];
+        totals[opIdx + 1].samples = totals[opIdx].samples + profile->samples[opIdx];
+    }
+    unsigned int loopNum = 0;
+    for (unsigned int opIdx = 0; opIdx < program->opNum; opIdx++)
+    {
+        if (program->ops[opIdx].code == opBeginLoop && profile->counts[opIdx])
+        {
+            const unsigned int end = program->ops[opIdx].arg + 1;
+            loops[loopNum++] = (struct HotSpot){
+                .opIdx = opIdx,
+                .count = totals[end].count - totals[opIdx].count,
+                .samples = totals[end].samples - totals[opIdx].samples,
+            };
+        }
+    }
+    return loopNum;
+}
+
+// Hot spot report, on the standard error like the error messages
+void printProfile(const struct Profile *const profile)
+{
+    const struct Program *const program = profile->program;
+    struct HotSpot *const spots = (struct HotSpot *)malloc(program->opNum * sizeof(struct HotSpot));
+    struct HotSpot *const totals = (struct HotSpot *)malloc((program->opNum + 1) * sizeof(struct HotSpot));
+    if (!spots || !totals)
+    {
+        fprintf(stderr, "\n[Error]: Couldn't print the profile: out of memory\n");
+        free((void *)spots);
+        free((void *)totals);
+        return;
+    }
+    const unsigned int loopNum = collectLoops(profile, spots, totals);
+    const unsigned long long totalCount = totals[program->opNum].count;
+    const unsigned long long totalSamples = totals[program->opNum].samples;
+    fprintf(stderr, "\n[Profile]: %llu operations executed in %.3f s of processor time, %llu samples\n", totalCount, profile->seconds, totalSamples);
+    qsort((void *)spots, loopNum, sizeof(struct HotSpot), compareHotSpots);
+    for (unsigned int spotIdx = 0; spotIdx < loopNum && spotIdx < HOT_SPOT_NUM; spotIdx++)
+    {
+        const struct HotSpot *const loop = &spots[spotIdx];
+        const struct Location location = opLocation(program, loop->opIdx);
+        const unsigned int end = program->ops[loop->opIdx].arg;
+        fprintf(stderr, "\n[Loop in line %d, column %d]: %.1f%% of the time (%.3f s), %.1f%% of the operations (%llu), reached %llu times, %llu iterations\n",
+                location.line, location.col, percentage(loop->samples, totalSamples), profile->seconds * percentage(loop->samples, totalSamples) / 100,
+                percentage(loop->count, totalCount), loop->count, profile->counts[loop->opIdx], profile->counts[end]);
+        codeExcerpt(program, loop->opIdx);
+    }
+    unsigned int spotNum = 0;
+    for (unsigned int opIdx = 0; opIdx < program->opNum; opIdx++)
+    {
+        if (profile->counts[opIdx] && program->ops[opIdx].code != opEnd)
+        {
+            spots[spotNum++] = (struct HotSpot){.opIdx = opIdx, .count = profile->counts[opIdx], .samples = profile->samples[opIdx]};
+        }
+    }
+    qsort((void *)spots, spotNum, sizeof(struct HotSpot), compareHotSpots);
+    for (unsigned int spotIdx = 0; spotIdx < spotNum && spotIdx < HOT_SPOT_NUM; spotIdx++)
+    {
+        const struct HotSpot *const spot = &spots[spotIdx];
+        const struct Location location = opLocation(program, spot->opIdx);
+        fprintf(stderr, "\n[Instruction in line %d, column %d]: %.1f%% of the time (%.3f s), executed %llu times\n",
+                location.line, location.col, percentage(spot->samples, totalSamples), profile->seconds * percentage(spot->samples, totalSamples) / 100, spot->count);
+        codeExcerpt(program, spot->opIdx);
+    }
+    free((void *)spots);
+    free((void *)totals);
+}
+
+//------------------------------------------------------------------------------
+// END
+//------------------------------------------------------------------------------
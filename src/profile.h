@@ -0,0 +1,42 @@
+#ifndef __PROFILE
+#define __PROFILE
+
+//------------------------------------------------------------------------------
+// LIBRARIES
+//------------------------------------------------------------------------------
+
+#include "program.h"
+
+//------------------------------------------------------------------------------
+// USER TYPES
+//------------------------------------------------------------------------------
+
+// Executions of every operation, counted by the profiling engines, and
+// samples of the operation running, taken by a processor time timer
+struct Profile
+{
+    const struct Program *program;
+    unsigned long long *counts;
+    unsigned long long *samples;
+    // written by the engines before every operation, read by the timer
+    const struct Op *volatile current;
+    // processor time of the runs, shared between the operations in
+    // proportion to their samples, as the timer may miss some of them
+    double seconds;
+    double startSeconds;
+};
+
+//------------------------------------------------------------------------------
+// FUNCTION PROTOTYPES
+//------------------------------------------------------------------------------
+
+struct Profile *newProfile(const struct Program *const program);
+void freeProfile(struct Profile *const profile);
+void startProfile(struct Profile *const profile);
+void stopProfile(struct Profile *const profile);
+void printProfile(const struct Profile *const profile);
+
+//------------------------------------------------------------------------------
+// END
+//------------------------------------------------------------------------------
+#endif // __PROFILE
@@ -0,0 +1,155 @@
+//------------------------------------------------------------------------------
+// LIBRARIES
+//------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include "program.h"
+#include "prefix.h"
+
+//------------------------------------------------------------------------------
+// FUNCTIONS
+//------------------------------------------------------------------------------
+
+struct Program *newProgram(const char *const source, const size_t sourceLength, const int debugCommands)
+{
+    struct Program *program = (struct Program *)malloc(sizeof(struct Program));
+    if (program)
+    {
+        *program = (struct Program){
+            .source = source,
+            .sourceLength = sourceLength,
+            .next = 0,
+            .ops = NULL,
+            .offsets = NULL,
+            .opNum = 0,
+            .opCapacity = 0,
+            .lineStarts = NULL,
+            .lineNum = 0,
+            .lineCapacity = 0,
+            .debugCommands = debugCommands,
+            .prefix = NULL,
+            .cache = NULL,
+            .cacheSize = 0,
+        };
+    }
+    return program;
+}
+
+void freeProgram(struct Program *const program)
+{
+    if (program)
+    {
+        if (program->cache)
+        {
+            munmap(program->cache, program->cacheSize);
+            free((void *)program->prefix);
+        }
+        else
+        {
+            free((void *)program->ops);
+            free((void *)program->offsets);
+            free((void *)program->lineStarts);
+            freePrefix(program->prefix);
+        }
+        free((void *)program);
+    }
+}
+
+int appendOp(struct Program *const program, const struct Op op, const size_t offset)
+{
+    if (program->opNum >= program->opCapacity)
+    {
+        // grows geometrically, so the compilation remains linear in the source size
+        const unsigned int capacity = program->opCapacity ? 2 * program->opCapacity : 1024;
+        struct Op *newOps = (struct Op *)realloc((void *)program->ops, capacity * sizeof(struct Op));
+        if (!newOps)
+        {
+            return EXIT_FAILURE;
+        }
+        program->ops = newOps;
+        size_t *newOffsets = (size_t *)realloc((void *)program->offsets, capacity * sizeof(size_t));
+        if (!newOffsets)
+        {
+            return EXIT_FAILURE;
+        }
+        program->offsets = newOffsets;
+        program->opCapacity = capacity;
+    }
+    program->ops[program->opNum] = op;
+    program->offsets[program->opNum] = offset;
+    program->opNum++;
+    return EXIT_SUCCESS;
+}
+
+// Records the start of a line, at the offset that follows a newline
+int appendLine(struct Program *const program, const size_t offset)
+{
+    if (program->lineNum >= program->lineCapacity)
+    {
+        const unsigned int capacity = program->lineCapacity ? 2 * program->lineCapacity : 1024;
+        size_t *newLineStarts = (size_t *)realloc((void *)program->lineStarts, capacity * sizeof(size_t));
+        if (!newLineStarts)
+        {
+            return EXIT_FAILURE;
+        }
+        program->lineStarts = newLineStarts;
+        program->lineCapacity = capacity;
+    }
+    program->lineStarts[program->lineNum++] = offset;
+    return EXIT_SUCCESS;
+}
+
+// Line and column of an operation, from the lines that start at or before it
+struct Location opLocation(const struct Program *const program, const unsigned int opIdx)
+{
+    const size_t offset = program->offsets[opIdx];
+    unsigned int low = 0, high = program->lineNum;
+    while (low < high)
+    {
+        const unsigned int middle = low + (high - low) / 2;
+        if (program->lineStarts[middle] <= offset)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+    const size_t lineStart = low ? program->lineStarts[low - 1] : 0;
+    return (struct Location){.line = low + 1, .col = (unsigned int)(offset - lineStart + 1), .offset = offset};
+}
+
+// Prints the source line of the operation, with a mark under its column
+void codeExcerpt(const struct Program *const program, const unsigned int opIdx)
+{
+    const struct Location location = opLocation(program, opIdx);
+    if (!program->source)
+    {
+        return;
+    }
+    const char *const lineStart = program->source + location.offset - (location.col - 1);
+    const char *const sourceEnd = program->source + program->sourceLength;
+    const char *const lineEnd = (const char *)memchr(lineStart, '\n', sourceEnd - lineStart);
+    const int lineLength = (lineEnd ? lineEnd : sourceEnd) - lineStart;
+    fprintf(stderr, "%.*s\n", lineLength, lineStart);
+    for (unsigned int columns = location.col; columns > 1; columns--)
+    {
+        putc(' ', stderr);
+    }
+    fprintf(stderr, "^\n");
+}
+
+void codeError(const struct Program *const program, const unsigned int opIdx, const char *const msg)
+{
+    const struct Location location = opLocation(program, opIdx);
+    fprintf(stderr, "\n[Error in line %d, column %d]: %s\n", location.line, location.col, msg);
+    codeExcerpt(program, opIdx);
+}
+
+//------------------------------------------------------------------------------
+// END
+//------------------------------------------------------------------------------
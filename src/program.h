@@ -0,0 +1,96 @@
+#ifndef __PROGRAM
+#define __PROGRAM
+
+//------------------------------------------------------------------------------
+// LIBRARIES
+//------------------------------------------------------------------------------
+
+#include <stddef.h>
+
+//------------------------------------------------------------------------------
+// USER TYPES
+//------------------------------------------------------------------------------
+
+enum OpCode
+{
+    opMove = 0,
+    opAdd,
+    opOutputByte,
+    opGetByte,
+    opBeginLoop,
+    opEndLoop,
+    opPrintCell,
+    opPrintAllCells,
+    opClear,
+    opMultiply,
+    opScan,
+    opClearRange,
+    opEnd,
+    opNum,
+};
+
+struct Prefix;
+
+// Position in the source code of a compiled operation, found from its offset
+struct Location
+{
+    unsigned int line;
+    unsigned int col;
+    size_t offset;
+};
+
+struct Op
+{
+    unsigned char code;
+    // moves, additions and scans: signed amount, multiplications: factor,
+    // clear ranges: signed distance to the last cell cleared, loops: index of
+    // the matching bracket
+    int arg;
+    // multiplications: offset of the destination cell
+    int offset;
+};
+
+// Compiled form of the source code: comments are stripped and every
+// operation keeps the offset of its source in a side table used for errors,
+// which the table of the lines turns into a line and a column.
+// The source is only available if it was loaded in memory as a whole.
+struct Program
+{
+    const char *source;
+    size_t sourceLength;
+    // offset of the next byte of source code, while compiling
+    size_t next;
+    struct Op *ops;
+    size_t *offsets;
+    unsigned int opNum;
+    unsigned int opCapacity;
+    // offset of the start of every line after the first one
+    size_t *lineStarts;
+    unsigned int lineNum;
+    unsigned int lineCapacity;
+    // the debug commands are compiled, otherwise they are comments
+    int debugCommands;
+    // state after the start that doesn't read the input, or NULL
+    struct Prefix *prefix;
+    // mapping of the cache file that holds the operations, their locations
+    // and the data of the prefix, or NULL if they were allocated
+    void *cache;
+    size_t cacheSize;
+};
+
+//------------------------------------------------------------------------------
+// FUNCTION PROTOTYPES
+//------------------------------------------------------------------------------
+
+struct Program *newProgram(const char *const source, const size_t sourceLength, const int debugCommands);
+void freeProgram(struct Program *const program);
+int appendOp(struct Program *const program, const struct Op op, const size_t offset);
+int appendLine(struct Program *const program, const size_t offset);
+struct Location opLocation(const struct Program *const program, const unsigned int opIdx);
+void codeExcerpt(const struct Program *const program, const unsigned int opIdx);
+void codeError(const struct Program *const program, const unsigned int opIdx, const char *const msg);
+
+//------------------------------------------------------------------------------
+// END
+//------------------------------------------------------------------------------
+#endif // __PROGRAM
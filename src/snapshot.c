@@ -0,0 +1,561 @@
+//------------------------------------------------------------------------------
+// LIBRARIES
+//------------------------------------------------------------------------------
+
+#define _DEFAULT_SOURCE // fsync, ftruncate, fileno
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "snapshot.h"
+#include "hash.h"
+#include "tape.h"
+#include "io.h"
+
+//------------------------------------------------------------------------------
+// DEFINITIONS
+//------------------------------------------------------------------------------
+
+#define SNAPSHOT_MAGIC "BFSNAP01"
+
+//------------------------------------------------------------------------------
+// USER TYPES
+//------------------------------------------------------------------------------
+
+// A snapshot file is a header followed by frames, in the byte order of the
+// machine. The first frame holds every page of the tape that isn't zero, and
+// the incremental snapshots append frames with the pages changed since the
+// previous one, so the state is the last frame applied over the others. Every
+// structure is a multiple of 8 bytes, so the file can be mapped and read in
+// place, and a frame cut short by a crash is detected by its size and
+// checksum, and ignored.
+struct SnapshotHeader
+{
+    char magic[8];
+    uint64_t programHash;
+    uint32_t cellBits;
+    uint32_t tapeMode;
+    uint32_t memorySize;
+    uint32_t pageSize;
+};
+
+struct SnapshotFrame
+{
+    // bytes of the frame, this header included
+    uint64_t size;
+    // of the pages, then of this header with a zero checksum
+    uint64_t checksum;
+    uint64_t steps;
+    uint64_t inputBytes;
+    uint64_t outputBytes;
+    uint64_t pageNum;
+    uint32_t opIdx;
+    uint32_t mIndex;
+    uint32_t minIndex;
+    uint32_t maxIndex;
+};
+
+// Followed by the SNAPSHOT_PAGE_SIZE bytes of the page, the bytes beyond the
+// tape are zero
+struct SnapshotPage
+{
+    // tape bytes from page * SNAPSHOT_PAGE_SIZE, counted from the cell 0
+    uint64_t page;
+};
+
+// What the last file written or read holds, to find the changed pages
+struct SnapshotState
+{
+    char *fileName;
+    // hash of the pages [firstPage, firstPage + pageNum) in the file
+    uint64_t *hashes;
+    uint64_t firstPage;
+    uint64_t pageNum;
+    // bytes of the file, and of the header and the first frame
+    uint64_t fileSize;
+    uint64_t fullSize;
+};
+
+//------------------------------------------------------------------------------
+// FUNCTIONS
+//------------------------------------------------------------------------------
+
+static uint64_t programHash(const struct Program *const program)
+{
+    uint64_t hash = HASH_BASIS;
+    for (unsigned int opIdx = 0; opIdx < program->opNum; opIdx++)
+    {
+        const int64_t fields[3] = {program->ops[opIdx].code, program->ops[opIdx].arg, program->ops[opIdx].offset};
+        hash = hashBytes(hash, fields, sizeof(fields));
+    }
+    return hash;
+}
+
+static uint64_t frameChecksum(uint64_t hash, struct SnapshotFrame frame)
+{
+    frame.checksum = 0;
+    return hashBytes(hash, &frame, sizeof(frame));
+}
+
+static void tapeBytes(const struct Environment *const env, uint64_t *const low, uint64_t *const high)
+{
+    const uint64_t cellSize = env->options.cellBits / 8;
+    *low = env->lowIndex * cellSize;
+    *high = env->size * cellSize;
+}
+
+// Copies a page of the tape, or its part on the tape
+static void copyPage(const struct Environment *const env, const uint64_t page, unsigned char *const data)
+{
+    uint64_t low, high;
+    tapeBytes(env, &low, &high);
+    const uint64_t first = page * SNAPSHOT_PAGE_SIZE;
+    const uint64_t start = first > low ? first : low;
+    const uint64_t end = first + SNAPSHOT_PAGE_SIZE < high ? first + SNAPSHOT_PAGE_SIZE : high;
+    memset(data, 0, SNAPSHOT_PAGE_SIZE);
+    if (start < end)
+    {
+        memcpy(&data[start - first], (const unsigned char *)env->mem + start, end - start);
+    }
+}
+
+static void restorePage(struct Environment *const env, const uint64_t page, const unsigned char *const data)
+{
+    uint64_t low, high;
+    tapeBytes(env, &low, &high);
+    const uint64_t first = page * SNAPSHOT_PAGE_SIZE;
+    const uint64_t start = first > low ? first : low;
+    const uint64_t end = first + SNAPSHOT_PAGE_SIZE < high ? first + SNAPSHOT_PAGE_SIZE : high;
+    if (start < end)
+    {
+        memcpy((unsigned char *)env->mem + start, &data[start - first], end - start);
+    }
+}
+
+void freeSnapshot(struct SnapshotState *const state)
+{
+    if (state)
+    {
+        free((void *)state->fileName);
+        free((void *)state->hashes);
+        free((void *)state);
+    }
+}
+
+static struct SnapshotState *newSnapshot(const char *const fileName)
+{
+    struct SnapshotState *const state = (struct SnapshotState *)calloc(1, sizeof(struct SnapshotState));
+    if (!state)
+    {
+        return NULL;
+    }
+    state->fileName = (char *)malloc(strlen(fileName) + 1);
+    if (!state->fileName)
+    {
+        freeSnapshot(state);
+        return NULL;
+    }
+    strcpy(state->fileName, fileName);
+    return state;
+}
+
+// Extends the pages tracked to [first, last], the new ones are zero
+static int trackPages(struct SnapshotState *const state, const uint64_t first, const uint64_t last)
+{
+    static unsigned char zeroPage[SNAPSHOT_PAGE_SIZE];
+    const uint64_t zeroHash = hashBytes(HASH_BASIS, zeroPage, sizeof(zeroPage));
+    const uint64_t oldFirst = state->pageNum ? state->firstPage : first;
+    const uint64_t oldLast = state->pageNum ? state->firstPage + state->pageNum - 1 : first;
+    const uint64_t newFirst = first < oldFirst ? first : oldFirst;
+    const uint64_t newLast = last > oldLast ? last : oldLast;
+    const uint64_t pageNum = newLast - newFirst + 1;
+    if (pageNum == state->pageNum)
+    {
+        return EXIT_SUCCESS;
+    }
+    uint64_t *const hashes = (uint64_t *)malloc(pageNum * sizeof(uint64_t));
+    if (!hashes)
+    {
+        return EXIT_FAILURE;
+    }
+    for (uint64_t page = 0; page < pageNum; page++)
+    {
+        hashes[page] = zeroHash;
+    }
+    if (state->pageNum)
+    {
+        memcpy(&hashes[state->firstPage - newFirst], state->hashes, state->pageNum * sizeof(uint64_t));
+    }
+    free((void *)state->hashes);
+    state->hashes = hashes;
+    state->firstPage = newFirst;
+    state->pageNum = pageNum;
+    return EXIT_SUCCESS;
+}
+
+// Pages of the cells reached, the others were never written
+static void pageRange(const unsigned int cellBits, const unsigned int minIndex, const unsigned int maxIndex, uint64_t *const first, uint64_t *const last)
+{
+    const uint64_t cellSize = cellBits / 8;
+    *first = minIndex * cellSize / SNAPSHOT_PAGE_SIZE;
+    *last = (maxIndex * cellSize + cellSize - 1) / SNAPSHOT_PAGE_SIZE;
+}
+
+// First page from the given one that holds a touched cell. The pages of the
+// paged tapes never touched are zero, as the state has them, so they are
+// skipped without being read.
+static uint64_t nextTouchedPage(struct Environment *const env, const uint64_t page)
+{
+    const uint64_t cellSize = env->options.cellBits / 8;
+    const uint64_t cell = page * SNAPSHOT_PAGE_SIZE / cellSize;
+    if (cell > env->maxIndex)
+    {
+        return page;
+    }
+    const unsigned int index = nextTouchedCell(env, cell > env->minIndex ? (unsigned int)cell : env->minIndex);
+    return (uint64_t)index * cellSize / SNAPSHOT_PAGE_SIZE;
+}
+
+// Writes the pages that differ from the ones in the state, and updates it
+static int writeFrame(struct Environment *const env, struct SnapshotState *const state, FILE *const file, uint64_t *const size)
+{
+    struct Usage usage;
+    environmentUsage(env, &usage);
+    struct SnapshotFrame frame = {
+        .size = sizeof(struct SnapshotFrame),
+        .checksum = HASH_BASIS,
+        .steps = usage.steps,
+        .inputBytes = usage.inputBytes,
+        .outputBytes = usage.outputBytes,
+        .pageNum = 0,
+        .opIdx = env->op - env->program->ops,
+        .mIndex = env->mIndex,
+        .minIndex = env->minIndex,
+        .maxIndex = env->maxIndex,
+    };
+    uint64_t first, last;
+    pageRange(env->options.cellBits, env->minIndex, env->maxIndex, &first, &last);
+    if (trackPages(state, first, last))
+    {
+        return EXIT_FAILURE;
+    }
+    // the header is written again at the end, with the checksum
+    const long start = ftell(file);
+    if (start < 0 || fwrite(&frame, sizeof(frame), 1, file) != 1)
+    {
+        return EXIT_FAILURE;
+    }
+    for (uint64_t page = nextTouchedPage(env, first); page <= last; page = nextTouchedPage(env, page + 1))
+    {
+        unsigned char data[SNAPSHOT_PAGE_SIZE];
+        copyPage(env, page, data);
+        const uint64_t hash = hashBytes(HASH_BASIS, data, sizeof(data));
+        uint64_t *const stored = &state->hashes[page - state->firstPage];
+        if (hash == *stored)
+        {
+            continue;
+        }
+        const struct SnapshotPage record = {.page = page};
+        if (fwrite(&record, sizeof(record), 1, file) != 1 || fwrite(data, sizeof(data), 1, file) != 1)
+        {
+            return EXIT_FAILURE;
+        }
+        frame.checksum = hashBytes(frame.checksum, &record, sizeof(record));
+        frame.checksum = hashBytes(frame.checksum, data, sizeof(data));
+        frame.size += sizeof(record) + sizeof(data);
+        frame.pageNum++;
+        *stored = hash;
+    }
+    frame.checksum = frameChecksum(frame.checksum, frame);
+    if (fseek(file, start, SEEK_SET) || fwrite(&frame, sizeof(frame), 1, file) != 1 || fseek(file, 0, SEEK_END))
+    {
+        return EXIT_FAILURE;
+    }
+    *size = frame.size;
+    return EXIT_SUCCESS;
+}
+
+static int closeDurably(FILE *const file)
+{
+    const int flushed = !fflush(file) && !fsync(fileno(file));
+    return (fclose(file) || !flushed) ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+// A full snapshot replaces the file at once, through a temporary file
+static int writeFull(struct Environment *const env, struct SnapshotState *const state)
+{
+    char *const tempName = (char *)malloc(strlen(state->fileName) + sizeof(".tmp"));
+    if (!tempName)
+    {
+        return EXIT_FAILURE;
+    }
+    sprintf(tempName, "%s.tmp", state->fileName);
+    FILE *const file = fopen(tempName, "wb");
+    if (!file)
+    {
+        free((void *)tempName);
+        return EXIT_FAILURE;
+    }
+    struct SnapshotHeader header = {
+        .programHash = programHash(env->program),
+        .cellBits = env->options.cellBits,
+        .tapeMode = env->options.tapeMode,
+        .memorySize = env->options.memorySize,
+        .pageSize = SNAPSHOT_PAGE_SIZE,
+    };
+    memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic));
+    uint64_t frameSize = 0;
+    int result = (fwrite(&header, sizeof(header), 1, file) != 1 || writeFrame(env, state, file, &frameSize));
+    result = closeDurably(file) || result;
+    if (result || rename(tempName, state->fileName))
+    {
+        const int error = errno;
+        remove(tempName);
+        errno = error;
+        result = EXIT_FAILURE;
+    }
+    free((void *)tempName);
+    state->fileSize = sizeof(header) + frameSize;
+    state->fullSize = state->fileSize;
+    return result;
+}
+
+static int appendFrame(struct Environment *const env, struct SnapshotState *const state)
+{
+    FILE *const file = fopen(state->fileName, "r+b");
+    if (!file)
+    {
+        return EXIT_FAILURE;
+    }
+    // drops what a failed append may have left
+    uint64_t frameSize = 0;
+    int result = (ftruncate(fileno(file), (off_t)state->fileSize) || fseek(file, 0, SEEK_END) || writeFrame(env, state, file, &frameSize));
+    result = closeDurably(file) || result;
+    state->fileSize += frameSize;
+    return result;
+}
+
+// Saves the state of a stopped program. An incremental snapshot appends the
+// changed pages to the file written last, until the increments are larger
+// than the whole tape, and the file is written again.
+const char *writeSnapshot(struct Environment *const env, const char *const fileName, const int incremental)
+{
+    if (!env->options.snapshotMode)
+    {
+        return "The environment isn't in snapshot mode";
+    }
+    if (env->error)
+    {
+        return "The program failed";
+    }
+    struct SnapshotState *state = env->snapshot;
+    errno = 0;
+    const int full = !incremental || !state || strcmp(state->fileName, fileName) || state->fileSize - state->fullSize > state->fullSize;
+    if (full)
+    {
+        freeSnapshot(state);
+        state = env->snapshot = newSnapshot(fileName);
+        if (!state)
+        {
+            return "Out of memory";
+        }
+    }
+    if (full ? writeFull(env, state) : appendFrame(env, state))
+    {
+        const char *const msg = errno ? strerror(errno) : "Out of memory";
+        // the file may not hold what the state says anymore
+        freeSnapshot(env->snapshot);
+        env->snapshot = NULL;
+        return msg;
+    }
+    return NULL;
+}
+
+static int checkHeader(const struct Environment *const env, const struct SnapshotHeader *const header)
+{
+    return !memcmp(header->magic, SNAPSHOT_MAGIC, sizeof(header->magic)) &&
+           header->programHash == programHash(env->program) &&
+           header->cellBits == env->options.cellBits &&
+           header->tapeMode == (uint32_t)env->options.tapeMode &&
+           (header->memorySize == env->options.memorySize || env->options.tapeMode == tapeUnbounded) &&
+           header->pageSize == SNAPSHOT_PAGE_SIZE;
+}
+
+// The program continues at the begin of a loop, where the runs stop, or at
+// its start or end
+static int checkFrame(const struct Environment *const env, const struct SnapshotFrame *const frame, const unsigned char *const pages)
+{
+    const struct Program *const program = env->program;
+    if (frame->opIdx >= program->opNum)
+    {
+        return EXIT_FAILURE;
+    }
+    const unsigned char code = program->ops[frame->opIdx].code;
+    if ((code != opBeginLoop && code != opEnd && frame->opIdx) ||
+        frame->minIndex < env->lowIndex || frame->maxIndex >= env->size || frame->minIndex > frame->maxIndex ||
+        frame->mIndex < frame->minIndex || frame->mIndex > frame->maxIndex)
+    {
+        return EXIT_FAILURE;
+    }
+    uint64_t first, last;
+    pageRange(env->options.cellBits, frame->minIndex, frame->maxIndex, &first, &last);
+    const size_t recordSize = sizeof(struct SnapshotPage) + SNAPSHOT_PAGE_SIZE;
+    for (uint64_t pageIdx = 0; pageIdx < frame->pageNum; pageIdx++)
+    {
+        const struct SnapshotPage *const record = (const struct SnapshotPage *)(pages + pageIdx * recordSize);
+        if (record->page < first || record->page > last)
+        {
+            return EXIT_FAILURE;
+        }
+    }
+    return EXIT_SUCCESS;
+}
+
+static void applyFrame(struct Environment *const env, const struct SnapshotFrame *const frame, const unsigned char *const pages)
+{
+    const size_t recordSize = sizeof(struct SnapshotPage) + SNAPSHOT_PAGE_SIZE;
+    for (uint64_t pageIdx = 0; pageIdx < frame->pageNum; pageIdx++)
+    {
+        const struct SnapshotPage *const record = (const struct SnapshotPage *)(pages + pageIdx * recordSize);
+        restorePage(env, record->page, (const unsigned char *)(record + 1));
+    }
+    env->op = &env->program->ops[frame->opIdx];
+    env->mIndex = frame->mIndex;
+    env->minIndex = frame->minIndex;
+    env->maxIndex = frame->maxIndex;
+    env->steps = frame->steps;
+    env->countdown = 0;
+    env->error = NULL;
+    // the snapshot was taken after the prefix of the program
+    env->prefix = NULL;
+    // the input consumed before the snapshot is skipped
+    env->input.position = 0;
+    env->input.size = 0;
+    env->input.offset = 0;
+    env->input.skip = frame->inputBytes;
+    env->output.written = frame->outputBytes;
+}
+
+// Hashes of the pages restored, so the next incremental snapshot appends to
+// the same file
+static struct SnapshotState *restoredState(const struct Environment *const env, const char *const fileName, const unsigned char *const data, const uint64_t fileSize, const uint64_t fullSize)
+{
+    struct SnapshotState *const state = newSnapshot(fileName);
+    uint64_t first, last;
+    pageRange(env->options.cellBits, env->minIndex, env->maxIndex, &first, &last);
+    if (!state || trackPages(state, first, last))
+    {
+        freeSnapshot(state);
+        return NULL;
+    }
+    state->fileSize = fileSize;
+    state->fullSize = fullSize;
+    const size_t recordSize = sizeof(struct SnapshotPage) + SNAPSHOT_PAGE_SIZE;
+    for (uint64_t offset = sizeof(struct SnapshotHeader); offset < fileSize;)
+    {
+        const struct SnapshotFrame *const frame = (const struct SnapshotFrame *)(data + offset);
+        const unsigned char *const pages = data + offset + sizeof(struct SnapshotFrame);
+        for (uint64_t pageIdx = 0; pageIdx < frame->pageNum; pageIdx++)
+        {
+            const struct SnapshotPage *const record = (const struct SnapshotPage *)(pages + pageIdx * recordSize);
+            if (record->page >= first && record->page <= last)
+            {
+                unsigned char page[SNAPSHOT_PAGE_SIZE];
+                copyPage(env, record->page, page);
+                state->hashes[record->page - first] = hashBytes(HASH_BASIS, page, sizeof(page));
+            }
+        }
+        offset += frame->size;
+    }
+    return state;
+}
+
+// Restores the state saved in a snapshot of the same program, with the same
+// cells and tape. Only the pages stored are written, so on an environment
+// that didn't run yet, the time taken doesn't depend on the size of the tape.
+const char *readSnapshot(struct Environment *const env, const char *const fileName)
+{
+    const int fd = open(fileName, O_RDONLY);
+    if (fd < 0)
+    {
+        return strerror(errno);
+    }
+    struct stat status;
+    if (fstat(fd, &status))
+    {
+        const int error = errno;
+        close(fd);
+        return strerror(error);
+    }
+    const uint64_t fileSize = (uint64_t)status.st_size;
+    if (fileSize < sizeof(struct SnapshotHeader) + sizeof(struct SnapshotFrame))
+    {
+        close(fd);
+        return "Not a snapshot";
+    }
+    void *const address = mmap(NULL, fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (address == MAP_FAILED)
+    {
+        return strerror(errno);
+    }
+    const unsigned char *const data = (const unsigned char *)address;
+    const char *msg = NULL;
+    if (!checkHeader(env, (const struct SnapshotHeader *)data))
+    {
+        msg = "Not a snapshot of this program, with these cells and tape";
+    }
+    else if (env->op != env->program->ops || env->maxIndex != env->origin || env->minIndex != env->origin || env->steps)
+    {
+        // the environment ran: its tape is cleared first
+        if (resetTape(env))
+        {
+            msg = "Couldn't clear the memory";
+        }
+    }
+    // every complete frame is applied, in order
+    const size_t recordSize = sizeof(struct SnapshotPage) + SNAPSHOT_PAGE_SIZE;
+    uint64_t offset = sizeof(struct SnapshotHeader);
+    uint64_t fullSize = 0;
+    while (!msg && offset + sizeof(struct SnapshotFrame) <= fileSize)
+    {
+        const struct SnapshotFrame *const frame = (const struct SnapshotFrame *)(data + offset);
+        const unsigned char *const pages = data + offset + sizeof(struct SnapshotFrame);
+        if (frame->size > fileSize - offset || frame->pageNum > fileSize / recordSize ||
+            frame->size != sizeof(struct SnapshotFrame) + frame->pageNum * recordSize ||
+            frameChecksum(hashBytes(HASH_BASIS, pages, frame->pageNum * recordSize), *frame) != frame->checksum)
+        {
+            break;
+        }
+        if (checkFrame(env, frame, pages))
+        {
+            msg = "Corrupted snapshot";
+            break;
+        }
+        applyFrame(env, frame, pages);
+        offset += frame->size;
+        fullSize = fullSize ? fullSize : offset;
+    }
+    if (!msg && !fullSize)
+    {
+        msg = "Corrupted snapshot";
+    }
+    if (!msg)
+    {
+        freeSnapshot(env->snapshot);
+        // without it, the next incremental snapshot is a full one
+        env->snapshot = restoredState(env, fileName, data, offset, fullSize);
+    }
+    munmap(address, fileSize);
+    return msg;
+}
+
+//------------------------------------------------------------------------------
+// END
+//------------------------------------------------------------------------------
@@ -0,0 +1,28 @@
+#ifndef __SNAPSHOT
+#define __SNAPSHOT
+
+//------------------------------------------------------------------------------
+// LIBRARIES
+//------------------------------------------------------------------------------
+
+#include "engine.h"
+
+//------------------------------------------------------------------------------
+// DEFINITIONS
+//------------------------------------------------------------------------------
+
+// Bytes of tape stored together, whatever the page size of the system
+#define SNAPSHOT_PAGE_SIZE 4096
+
+//------------------------------------------------------------------------------
+// FUNCTION PROTOTYPES
+//------------------------------------------------------------------------------
+
+const char *writeSnapshot(struct Environment *const env, const char *const fileName, const int incremental);
+const char *readSnapshot(struct Environment *const env, const char *const fileName);
+void freeSnapshot(struct SnapshotState *const state);
+
+//------------------------------------------------------------------------------
+// END
+//------------------------------------------------------------------------------
+#endif // __SNAPSHOT
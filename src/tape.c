@@ -0,0 +1,308 @@
+//------------------------------------------------------------------------------
+// LIBRARIES
+//------------------------------------------------------------------------------
+
+#define _DEFAULT_SOURCE // MAP_ANONYMOUS, MAP_NORESERVE, pread
+
+#include <fcntl.h>
+#include <pthread.h>
+#include <setjmp.h>
+#include <signal.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include "tape.h"
+
+//------------------------------------------------------------------------------
+// DEFINITIONS
+//------------------------------------------------------------------------------
+
+// The JIT moves a pointer instead of an index, which doesn't wrap around, so
+// one more guard quarter is reserved on each side of the index range
+#define RESERVED_CELLS (6 * (size_t)TAPE_GUARD_CELLS)
+#define RESERVED_OFFSET TAPE_GUARD_CELLS
+
+// Pages whose residency is queried at once, when looking for touched cells
+#define RESIDENCY_PAGES 256
+
+//------------------------------------------------------------------------------
+// GLOBAL VARIABLES
+//------------------------------------------------------------------------------
+
+// The signal handlers are shared by the whole process, so the environment
+// running on an unbounded tape is found through a variable of its thread
+static __thread struct Environment *faultEnv = NULL;
+static __thread sigjmp_buf faultJump;
+static struct sigaction previousAction;
+static pthread_once_t handlerOnce = PTHREAD_ONCE_INIT;
+// The pages of the process, whose state is read from its page map, or -1
+static size_t pageSize;
+static int pageMap = -1;
+static pthread_once_t pagesOnce = PTHREAD_ONCE_INIT;
+
+//------------------------------------------------------------------------------
+// FUNCTIONS
+//------------------------------------------------------------------------------
+
+static void faultHandler(const int signal, siginfo_t *const info, void *const context)
+{
+    (void)signal;
+    (void)context;
+    const unsigned char *const address = (const unsigned char *)info->si_addr;
+    const struct Environment *const env = faultEnv;
+    if (env && address >= env->mapping && address < env->mapping + env->mappingSize)
+    {
+        siglongjmp(faultJump, 1);
+    }
+    // not an access to the tape: the faulting instruction runs again and crashes
+    sigaction(SIGSEGV, &previousAction, NULL);
+}
+
+// Installed once and for all, as other threads may be running on their tapes
+static void installFaultHandler(void)
+{
+    struct sigaction action;
+    action.sa_sigaction = faultHandler;
+    action.sa_flags = SA_SIGINFO;
+    sigemptyset(&action.sa_mask);
+    sigaction(SIGSEGV, &action, &previousAction);
+}
+
+static int newUnboundedTape(struct Environment *const env)
+{
+    const size_t cellSize = env->options.cellBits / 8;
+    const size_t size = RESERVED_CELLS * cellSize;
+    // the whole range is reserved without access, and only the usable half
+    // becomes accessible: the kernel commits its pages on first access
+    void *const address = mmap(NULL, size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (address == MAP_FAILED)
+    {
+        return EXIT_FAILURE;
+    }
+    unsigned char *const mem = (unsigned char *)address + RESERVED_OFFSET * cellSize;
+    if (mprotect(mem + TAPE_GUARD_CELLS * cellSize, (size_t)(TAPE_END - TAPE_GUARD_CELLS) * cellSize, PROT_READ | PROT_WRITE))
+    {
+        munmap(address, size);
+        return EXIT_FAILURE;
+    }
+    env->mapping = (unsigned char *)address;
+    env->mappingSize = size;
+    env->mem = mem;
+    env->lowIndex = TAPE_GUARD_CELLS;
+    env->size = TAPE_END;
+    env->origin = TAPE_ORIGIN;
+    return EXIT_SUCCESS;
+}
+
+static int newSparseTape(struct Environment *const env)
+{
+    // the pages are allocated and zeroed by the kernel when first written,
+    // while the reads of untouched pages share the same zero page
+    const size_t size = (size_t)env->options.memorySize * (env->options.cellBits / 8);
+    void *const address = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (address == MAP_FAILED)
+    {
+        return EXIT_FAILURE;
+    }
+    env->mapping = (unsigned char *)address;
+    env->mappingSize = size;
+    env->mem = address;
+    env->lowIndex = 0;
+    env->size = env->options.memorySize;
+    env->origin = 0;
+    return EXIT_SUCCESS;
+}
+
+int newTape(struct Environment *const env)
+{
+    if (env->options.tapeMode == tapeUnbounded)
+    {
+        if (newUnboundedTape(env))
+        {
+            return EXIT_FAILURE;
+        }
+    }
+    else if (env->options.tapeMode == tapeSparse)
+    {
+        if (newSparseTape(env))
+        {
+            return EXIT_FAILURE;
+        }
+    }
+    else
+    {
+        // calloc keeps the pages of large tapes untouched until they are used
+        const size_t size = (size_t)env->options.memorySize * (env->options.cellBits / 8);
+        const size_t padded = (size + TAPE_ALIGNMENT - 1) & ~(size_t)(TAPE_ALIGNMENT - 1);
+        unsigned char *const allocation = (unsigned char *)calloc(padded + TAPE_ALIGNMENT, 1);
+        if (!allocation)
+        {
+            return EXIT_FAILURE;
+        }
+        env->allocation = allocation;
+        env->mem = allocation + (-(uintptr_t)allocation & (TAPE_ALIGNMENT - 1));
+        env->lowIndex = 0;
+        env->size = env->options.memorySize;
+        env->origin = 0;
+    }
+    env->mIndex = env->origin;
+    env->minIndex = env->origin;
+    env->maxIndex = env->origin;
+    env->scan = scanKernel(env->options.cellBits);
+    return EXIT_SUCCESS;
+}
+
+void freeTape(struct Environment *const env)
+{
+    if (env->mapping)
+    {
+        munmap((void *)env->mapping, env->mappingSize);
+        env->mapping = NULL;
+    }
+    else
+    {
+        free(env->allocation);
+        env->allocation = NULL;
+    }
+    env->mem = NULL;
+}
+
+// Clears the tape for a new run, without allocating it again: the pages of
+// the paged tapes are given back to the kernel, and come back zeroed
+int resetTape(struct Environment *const env)
+{
+    if (env->mapping)
+    {
+        if (madvise((void *)env->mapping, env->mappingSize, MADV_DONTNEED))
+        {
+            return EXIT_FAILURE;
+        }
+    }
+    else
+    {
+        memset(env->mem, 0, (size_t)env->size * (env->options.cellBits / 8));
+    }
+    env->mIndex = env->origin;
+    env->minIndex = env->origin;
+    env->maxIndex = env->origin;
+    env->touchedLow = 0;
+    env->touchedHigh = 0;
+    return EXIT_SUCCESS;
+}
+
+static void openPageMap(void)
+{
+    pageSize = (size_t)sysconf(_SC_PAGESIZE);
+    pageMap = open("/proc/self/pagemap", O_RDONLY | O_CLOEXEC);
+}
+
+// Tells which of the pages from the given one were touched: in memory, or
+// swapped out, which only the page map reports. Without it, mincore() only
+// sees the pages in memory.
+static int touchedPages(const unsigned char *const page, const size_t pageNum, unsigned char *const touched)
+{
+    if (pageMap >= 0)
+    {
+        uint64_t entries[RESIDENCY_PAGES];
+        const size_t size = pageNum * sizeof(uint64_t);
+        if (pread(pageMap, entries, size, (off_t)((uintptr_t)page / pageSize * sizeof(uint64_t))) == (ssize_t)size)
+        {
+            for (size_t pageIdx = 0; pageIdx < pageNum; pageIdx++)
+            {
+                // bit 63: present, bit 62: swapped
+                touched[pageIdx] = (entries[pageIdx] >> 62) != 0;
+            }
+            return EXIT_SUCCESS;
+        }
+    }
+    if (mincore((void *)page, pageNum * pageSize, touched))
+    {
+        return EXIT_FAILURE;
+    }
+    for (size_t pageIdx = 0; pageIdx < pageNum; pageIdx++)
+    {
+        touched[pageIdx] &= 1;
+    }
+    return EXIT_SUCCESS;
+}
+
+// First cell from the given index whose page was touched, read or written,
+// so that @ skips the untouched regions of the paged tapes. The result is
+// beyond the tape if there is no such cell. The pages never go back to
+// untouched until the tape is reset, so the run of touched pages found last
+// is kept, and the next cells on it are returned without asking the kernel.
+unsigned int nextTouchedCell(struct Environment *const env, const unsigned int index)
+{
+    if (env->options.tapeMode == tapeFixed || (index >= env->touchedLow && index < env->touchedHigh))
+    {
+        return index;
+    }
+    pthread_once(&pagesOnce, openPageMap);
+    const size_t cellSize = env->options.cellBits / 8;
+    const unsigned char *const mem = (const unsigned char *)env->mem;
+    const unsigned char *const end = mem + (size_t)env->size * cellSize;
+    const unsigned char *page = mem + (size_t)index * cellSize;
+    page -= (uintptr_t)page % pageSize;
+    while (page < end)
+    {
+        unsigned char touched[RESIDENCY_PAGES];
+        const size_t length = (size_t)(end - page) < RESIDENCY_PAGES * pageSize ? (size_t)(end - page) : RESIDENCY_PAGES * pageSize;
+        const size_t pageNum = (length + pageSize - 1) / pageSize;
+        if (touchedPages(page, pageNum, touched))
+        {
+            // can't tell, so the cell is considered touched
+            return index;
+        }
+        size_t pageIdx = 0;
+        while (pageIdx < pageNum && !touched[pageIdx])
+        {
+            pageIdx++;
+        }
+        if (pageIdx < pageNum)
+        {
+            size_t lastIdx = pageIdx;
+            while (lastIdx < pageNum && touched[lastIdx])
+            {
+                lastIdx++;
+            }
+            const unsigned int first = (page + pageIdx * pageSize - mem) / cellSize;
+            const unsigned char *const last = page + lastIdx * pageSize;
+            env->touchedLow = first > index ? first : index;
+            env->touchedHigh = last < end ? (unsigned int)((last - mem) / cellSize) : env->size;
+            return env->touchedLow;
+        }
+        page += length;
+    }
+    return env->size;
+}
+
+enum RunStatus runOnTape(struct Environment *const env, EngineFunction run)
+{
+    if (env->options.tapeMode != tapeUnbounded)
+    {
+        return run(env);
+    }
+    pthread_once(&handlerOnce, installFaultHandler);
+    enum RunStatus result;
+    faultEnv = env;
+    if (sigsetjmp(faultJump, 1))
+    {
+        // the engines keep the last move in env->op, which took the pointer
+        // out of the tape
+        env->error = "Invalid pointer address";
+        result = runError;
+    }
+    else
+    {
+        result = run(env);
+    }
+    faultEnv = NULL;
+    return result;
+}
+
+//------------------------------------------------------------------------------
+// END
+//------------------------------------------------------------------------------
@@ -0,0 +1,40 @@
+#ifndef __TAPE
+#define __TAPE
+
+//------------------------------------------------------------------------------
+// LIBRARIES
+//------------------------------------------------------------------------------
+
+#include "engine.h"
+
+//------------------------------------------------------------------------------
+// DEFINITIONS
+//------------------------------------------------------------------------------
+
+// The unbounded tape reserves the whole range of cell indexes, 2^32 cells,
+// and only the middle half is usable. A move of any int amount from a usable
+// cell either stays in the usable half or lands in one of the guard quarters,
+// even when the index wraps around, so the engines don't check the moves: the
+// first access to a guard cell raises a fault instead.
+#define TAPE_GUARD_CELLS (1u << 30)
+#define TAPE_ORIGIN (1u << 31)
+#define TAPE_END (3u << 30)
+
+// The tapes start at this alignment and are padded to a multiple of it, so
+// the kernels may read the aligned vectors around any of their cells
+#define TAPE_ALIGNMENT 64
+
+//------------------------------------------------------------------------------
+// FUNCTION PROTOTYPES
+//------------------------------------------------------------------------------
+
+int newTape(struct Environment *const env);
+void freeTape(struct Environment *const env);
+int resetTape(struct Environment *const env);
+unsigned int nextTouchedCell(struct Environment *const env, const unsigned int index);
+enum RunStatus runOnTape(struct Environment *const env, EngineFunction run);
+
+//------------------------------------------------------------------------------
+// END
+//------------------------------------------------------------------------------
+#endif // __TAPE
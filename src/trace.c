@@ -0,0 +1,269 @@
+//------------------------------------------------------------------------------
+// LIBRARIES
+//------------------------------------------------------------------------------
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include "trace.h"
+
+//------------------------------------------------------------------------------
+// DEFINITIONS
+//------------------------------------------------------------------------------
+
+#define TRACE_MAGIC "BFTRACE1"
+
+//------------------------------------------------------------------------------
+// USER TYPES
+//------------------------------------------------------------------------------
+
+// A trace file is this header followed by the records, until its end. A
+// record cut short by a crash is ignored.
+struct TraceHeader
+{
+    char magic[8];
+    uint32_t opNum;
+    uint32_t recordSize;
+};
+
+//------------------------------------------------------------------------------
+// FUNCTIONS
+//------------------------------------------------------------------------------
+
+// Writes the chunks as they are published, until the trace is closed and
+// they are all written
+static void *writeChunks(void *const arg)
+{
+    struct Trace *const trace = (struct Trace *)arg;
+    pthread_mutex_lock(&trace->lock);
+    for (;;)
+    {
+        while (!trace->published && !trace->closing)
+        {
+            pthread_cond_wait(&trace->ready, &trace->lock);
+        }
+        if (!trace->published)
+        {
+            break;
+        }
+        const unsigned int chunk = trace->writing;
+        const size_t size = trace->sizes[chunk];
+        pthread_mutex_unlock(&trace->lock);
+        // after a failure, the chunks are dropped, so the engine never waits
+        errno = 0;
+        if (!trace->error && fwrite(&trace->records[chunk * TRACE_CHUNK_RECORDS], sizeof(struct TraceRecord), size, trace->file) != size)
+        {
+            trace->error = errno ? errno : EIO;
+        }
+        pthread_mutex_lock(&trace->lock);
+        trace->writing = (chunk + 1) % TRACE_CHUNK_NUM;
+        trace->published--;
+        pthread_cond_signal(&trace->drained);
+    }
+    pthread_mutex_unlock(&trace->lock);
+    return NULL;
+}
+
+// Operations compiled from the lines of the filter, which are in the order of
+// the source
+static void selectOperations(struct Trace *const trace, const struct TraceFilter *const filter)
+{
+    const struct Program *const program = trace->program;
+    unsigned int first = 0;
+    while (first < program->opNum && opLocation(program, first).line < filter->firstLine)
+    {
+        first++;
+    }
+    unsigned int last = first;
+    while (last < program->opNum && (!filter->lastLine || opLocation(program, last).line <= filter->lastLine))
+    {
+        last++;
+    }
+    trace->firstOp = first;
+    trace->opRange = last - first;
+    trace->firstStep = filter->firstStep;
+    trace->stepRange = filter->lastStep ? filter->lastStep - filter->firstStep + 1 : ~0ull - filter->firstStep;
+}
+
+// Creates the trace file and starts its writer. Returns NULL, or a message if
+// it fails.
+const char *startTrace(struct Trace **const trace, const struct Program *const program, const char *const fileName, const struct TraceFilter *const filter)
+{
+    static const struct TraceFilter everything = {.firstLine = 0, .lastLine = 0, .firstStep = 0, .lastStep = 0};
+    if (filter && ((filter->lastLine && filter->lastLine < filter->firstLine) || (filter->lastStep && filter->lastStep < filter->firstStep)))
+    {
+        return "Empty filter";
+    }
+    struct Trace *const newTrace = (struct Trace *)calloc(1, sizeof(struct Trace));
+    struct TraceRecord *const records = (struct TraceRecord *)malloc(TRACE_CHUNK_NUM * TRACE_CHUNK_RECORDS * sizeof(struct TraceRecord));
+    if (!newTrace || !records)
+    {
+        free((void *)newTrace);
+        free((void *)records);
+        return "Out of memory";
+    }
+    newTrace->program = program;
+    newTrace->records = records;
+    newTrace->chunk = records;
+    selectOperations(newTrace, filter ? filter : &everything);
+    const struct TraceHeader header = {.magic = TRACE_MAGIC, .opNum = program->opNum, .recordSize = sizeof(struct TraceRecord)};
+    errno = 0;
+    newTrace->file = fopen(fileName, "wb");
+    if (!newTrace->file || fwrite(&header, sizeof(header), 1, newTrace->file) != 1)
+    {
+        const char *const msg = errno ? strerror(errno) : "Couldn't write the file";
+        if (newTrace->file)
+        {
+            fclose(newTrace->file);
+        }
+        free((void *)records);
+        free((void *)newTrace);
+        return msg;
+    }
+    pthread_mutex_init(&newTrace->lock, NULL);
+    pthread_cond_init(&newTrace->ready, NULL);
+    pthread_cond_init(&newTrace->drained, NULL);
+    if (pthread_create(&newTrace->writer, NULL, writeChunks, (void *)newTrace))
+    {
+        pthread_mutex_destroy(&newTrace->lock);
+        pthread_cond_destroy(&newTrace->ready);
+        pthread_cond_destroy(&newTrace->drained);
+        fclose(newTrace->file);
+        free((void *)records);
+        free((void *)newTrace);
+        return "Couldn't start the writer thread";
+    }
+    *trace = newTrace;
+    return NULL;
+}
+
+// Hands the chunk filled to the writer and moves to the next one, waiting for
+// the writer if the ring is full
+void publishChunk(struct Trace *const trace)
+{
+    pthread_mutex_lock(&trace->lock);
+    trace->sizes[trace->filling] = trace->used;
+    trace->published++;
+    pthread_cond_signal(&trace->ready);
+    while (trace->published == TRACE_CHUNK_NUM)
+    {
+        pthread_cond_wait(&trace->drained, &trace->lock);
+    }
+    pthread_mutex_unlock(&trace->lock);
+    trace->filling = (trace->filling + 1) % TRACE_CHUNK_NUM;
+    trace->chunk = &trace->records[trace->filling * TRACE_CHUNK_RECORDS];
+    trace->used = 0;
+}
+
+// Publishes the records of a run that ended in the middle of a chunk
+void flushTrace(struct Trace *const trace)
+{
+    if (trace->used)
+    {
+        publishChunk(trace);
+    }
+}
+
+// Writes the records left, waits for the writer and closes the file. Returns
+// NULL, or the message of the first write that failed.
+const char *stopTrace(struct Trace *const trace)
+{
+    if (!trace)
+    {
+        return NULL;
+    }
+    flushTrace(trace);
+    pthread_mutex_lock(&trace->lock);
+    trace->closing = 1;
+    pthread_cond_signal(&trace->ready);
+    pthread_mutex_unlock(&trace->lock);
+    pthread_join(trace->writer, NULL);
+    int error = trace->error;
+    errno = 0;
+    if (fclose(trace->file) && !error)
+    {
+        error = errno ? errno : EIO;
+    }
+    pthread_mutex_destroy(&trace->lock);
+    pthread_cond_destroy(&trace->ready);
+    pthread_cond_destroy(&trace->drained);
+    free((void *)trace->records);
+    free((void *)trace);
+    return error ? strerror(error) : NULL;
+}
+
+static void printRecord(const struct Program *const program, const struct TraceRecord *const record)
+{
+    // the arguments that the format of an operation doesn't use are ignored
+    static const char *const formats[] = {
+        [opMove] = "move %+d",
+        [opAdd] = "add %+d",
+        [opOutputByte] = "output",
+        [opGetByte] = "input",
+        [opBeginLoop] = "loop begin",
+        [opEndLoop] = "loop end",
+        [opPrintCell] = "print cell",
+        [opPrintAllCells] = "print all cells",
+        [opClear] = "clear",
+        [opMultiply] = "multiply by %d into cell %+d",
+        [opScan] = "scan %+d",
+        [opClearRange] = "clear range %+d",
+        [opEnd] = "end",
+    };
+    const struct Op *const op = &program->ops[record->opIdx];
+    const struct Location location = opLocation(program, record->opIdx);
+    printf("step %llu, line %u, column %u: ", (unsigned long long)record->step, location.line, location.col);
+    printf(formats[op->code], op->arg, op->offset);
+    printf(", cell %d: %u\n", (int)record->cell, (unsigned int)record->value);
+}
+
+// Prints the records of a trace of the program on the standard output, one
+// per line. Returns NULL, or a message if the file can't be read or was
+// written for another program.
+const char *decodeTrace(const struct Program *const program, const char *const fileName)
+{
+    errno = 0;
+    FILE *const file = fopen(fileName, "rb");
+    if (!file)
+    {
+        return strerror(errno);
+    }
+    const char *msg = NULL;
+    struct TraceHeader header;
+    if (fread(&header, sizeof(header), 1, file) != 1 || memcmp(header.magic, TRACE_MAGIC, sizeof(header.magic)) ||
+        header.recordSize != sizeof(struct TraceRecord))
+    {
+        msg = "Not a trace";
+    }
+    else if (header.opNum != program->opNum)
+    {
+        msg = "Not a trace of this program";
+    }
+    struct TraceRecord records[TRACE_CHUNK_RECORDS];
+    size_t recordNum;
+    while (!msg && (recordNum = fread(records, sizeof(struct TraceRecord), TRACE_CHUNK_RECORDS, file)))
+    {
+        for (size_t recordIdx = 0; recordIdx < recordNum && !msg; recordIdx++)
+        {
+            const struct TraceRecord *const record = &records[recordIdx];
+            if (record->opIdx >= program->opNum || record->code != program->ops[record->opIdx].code)
+            {
+                msg = "Not a trace of this program";
+            }
+            else
+            {
+                printRecord(program, record);
+            }
+        }
+    }
+    if (!msg && ferror(file))
+    {
+        msg = "Couldn't read the file";
+    }
+    fclose(file);
+    return msg;
+}
+
+//------------------------------------------------------------------------------
+// END
+//------------------------------------------------------------------------------
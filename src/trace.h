@@ -0,0 +1,97 @@
+#ifndef __TRACE
+#define __TRACE
+
+//------------------------------------------------------------------------------
+// LIBRARIES
+//------------------------------------------------------------------------------
+
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include "brainfuck.h"
+#include "program.h"
+
+//------------------------------------------------------------------------------
+// DEFINITIONS
+//------------------------------------------------------------------------------
+
+// The ring holds TRACE_CHUNK_NUM chunks, handed to the writer thread one at a
+// time, so the engine only takes a lock once every TRACE_CHUNK_RECORDS records
+#define TRACE_CHUNK_RECORDS 4096
+#define TRACE_CHUNK_NUM 16
+
+//------------------------------------------------------------------------------
+// USER TYPES
+//------------------------------------------------------------------------------
+
+// An operation about to run, in the byte order of the machine
+struct TraceRecord
+{
+    // loop iterations run before it
+    uint64_t step;
+    uint32_t opIdx;
+    // position of the pointer, from the first cell of the program
+    int32_t cell;
+    uint32_t value;
+    uint32_t code;
+};
+
+// Records of the operations selected by the filter, written to the file by a
+// thread of their own while the program runs
+struct Trace
+{
+    const struct Program *program;
+    // the operations [firstOp, firstOp + opRange) are recorded in the loop
+    // iterations [firstStep, firstStep + stepRange)
+    unsigned int firstOp;
+    unsigned int opRange;
+    unsigned long long firstStep;
+    unsigned long long stepRange;
+    // chunk filled by the engine, and its records used
+    struct TraceRecord *chunk;
+    unsigned int used;
+    unsigned int filling;
+    // the chunks published follow the one the writer takes next, and the
+    // records used of each chunk published
+    struct TraceRecord *records;
+    unsigned int sizes[TRACE_CHUNK_NUM];
+    unsigned int writing;
+    unsigned int published;
+    int closing;
+    // errno of the first write that failed, only read after the writer ends
+    int error;
+    pthread_mutex_t lock;
+    pthread_cond_t ready;
+    pthread_cond_t drained;
+    pthread_t writer;
+    FILE *file;
+};
+
+//------------------------------------------------------------------------------
+// FUNCTION PROTOTYPES
+//------------------------------------------------------------------------------
+
+const char *startTrace(struct Trace **const trace, const struct Program *const program, const char *const fileName, const struct TraceFilter *const filter);
+const char *stopTrace(struct Trace *const trace);
+void publishChunk(struct Trace *const trace);
+void flushTrace(struct Trace *const trace);
+const char *decodeTrace(const struct Program *const program, const char *const fileName);
+
+// Called by the tracing engines before every operation
+static inline void traceOperation(struct Trace *const trace, const unsigned long long step, const unsigned int opIdx, const unsigned int code, const int cell, const unsigned int value)
+{
+    // the values out of the ranges wrap around and fail the same comparisons
+    if (opIdx - trace->firstOp < trace->opRange && step - trace->firstStep < trace->stepRange)
+    {
+        trace->chunk[trace->used] = (struct TraceRecord){.step = step, .opIdx = opIdx, .cell = cell, .value = value, .code = code};
+        if (++trace->used == TRACE_CHUNK_RECORDS)
+        {
+            publishChunk(trace);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// END
+//------------------------------------------------------------------------------
+#endif // __TRACE